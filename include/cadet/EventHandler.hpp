@@ -0,0 +1,117 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file 
+ * Defines interfaces for state dependent events.
+ */
+
+#ifndef LIBCADET_EVENTHANDLER_HPP_
+#define LIBCADET_EVENTHANDLER_HPP_
+
+#include "cadet/cadetCompilerInfo.hpp"
+#include "cadet/LibExportImport.hpp"
+#include "cadet/ParameterId.hpp"
+
+namespace cadet
+{
+
+class IModelSystem;
+
+/**
+ * @brief Provides read access to the current state of the simulation
+ */
+class CADET_API IEventState
+{
+public:
+	virtual ~IEventState() CADET_NOEXCEPT { }
+
+	/**
+	 * @brief Returns the number of DOFs of the (global) state vector
+	 * @return Number of DOFs
+	 */
+	virtual unsigned int numDofs() const CADET_NOEXCEPT = 0;
+
+	/**
+	 * @brief Returns the (global) state vector
+	 * @return Pointer to first element of the state vector
+	 */
+	virtual double const* solution() const CADET_NOEXCEPT = 0;
+
+	/**
+	 * @brief Returns the time derivative of the (global) state vector
+	 * @return Pointer to first element of the time derivative of the state vector
+	 */
+	virtual double const* solutionTimeDerivative() const CADET_NOEXCEPT = 0;
+
+	/**
+	 * @brief Returns the concentration of a component at an outlet port of a unit operation
+	 * @details Throws an InvalidParameterException if the unit operation, port, or component does not exist.
+	 * @param [in] unitOp Index of the unit operation
+	 * @param [in] port Index of the outlet port
+	 * @param [in] comp Index of the component
+	 * @return Outlet concentration
+	 */
+	virtual double outletConcentration(UnitOpIdx unitOp, unsigned int port, unsigned int comp) const = 0;
+};
+
+/**
+ * @brief Detects and handles state dependent events during time integration
+ * @details Events are defined as roots of event functions @f$ g_i(t, y, \dot{y}) @f$, which are located by
+ *          the time integrator. Once an event has been detected, the handler is able to modify the model
+ *          (e.g., change inlet profiles or flow rates) at the event time. Time integration is then
+ *          restarted at the event time, which avoids fixed section times for feedback controlled actions
+ *          such as fractionation or switching on breakthrough.
+ *
+ *          Note that parameter sensitivities do not account for the dependence of the event time on the parameters.
+ */
+class CADET_API IEventHandler
+{
+public:
+	virtual ~IEventHandler() CADET_NOEXCEPT { }
+
+	/**
+	 * @brief Returns the number of event functions
+	 * @details This function is called once at the beginning of the time integration.
+	 * @return Number of event functions
+	 */
+	virtual unsigned int numEvents() const CADET_NOEXCEPT = 0;
+
+	/**
+	 * @brief Evaluates the event functions
+	 * @details An event fires when an event function changes its sign. This function is called
+	 *          frequently by the time integrator and must not modify the model.
+	 * @param [in] t Current time point
+	 * @param [in] secIdx Index of the current section
+	 * @param [in] state Current state of the simulation
+	 * @param [out] g Array with values of the event functions (length is numEvents())
+	 */
+	virtual void evaluateEvents(double t, unsigned int secIdx, const IEventState& state, double* const g) = 0;
+
+	/**
+	 * @brief Handles fired events
+	 * @details This function is called when the time integrator has located a root of at least one event function.
+	 *          The model can be modified by setting its parameters (e.g., inlet profile coefficients, flow rates).
+	 * @param [in] t Time point of the event
+	 * @param [in] secIdx Index of the current section
+	 * @param [in] events Array with one element per event function (length is numEvents()), which is @c 0 if the
+	 *             event has not fired, @c 1 if the event function is increasing, and @c -1 if it is decreasing
+	 * @param [in] state State of the simulation at the event time
+	 * @param [in,out] model Simulated model
+	 * @return @c true if the model has been modified and time integration has to be restarted, otherwise @c false
+	 */
+	virtual bool handleEvents(double t, unsigned int secIdx, int const* events, const IEventState& state, IModelSystem& model) = 0;
+};
+
+} // namespace cadet
+
+#endif  // LIBCADET_EVENTHANDLER_HPP_
@@ -163,6 +163,26 @@ namespace cadet
 	 */
 	CADET_API LogLevel getLogLevel();
 
+	/**
+	 * @brief Enables or disables asynchronous delivery of log messages
+	 * @details If enabled, messages are formatted by the emitting thread and queued in a bounded
+	 *          lock-free queue. A background thread delivers them to the log receiver. Messages
+	 *          are dropped if the queue is full and the number of dropped messages is reported
+	 *          as a warning. Errors are delivered before the emitting function returns.
+	 *
+	 *          Disabling asynchronous logging delivers all pending messages. This function must
+	 *          not be called while other threads emit log messages.
+	 * @param [in] enable Determines whether asynchronous logging is enabled
+	 * @param [in] capacity Maximum number of queued messages (rounded up to a power of two)
+	 */
+	CADET_API void setAsyncLogging(bool enable, unsigned int capacity);
+
+	/**
+	 * @brief Waits until all pending log messages have been delivered to the log receiver
+	 * @details Does nothing if asynchronous logging is disabled.
+	 */
+	CADET_API void flushLog();
+
 } // namespace cadet
 
 extern "C"
@@ -186,6 +206,20 @@ extern "C"
 	 * @return Current log level
 	 */
 	CADET_API unsigned int cadetGetLogLevel();
+
+	/**
+	 * @brief Enables or disables asynchronous delivery of log messages
+	 * @details Must not be called while other threads emit log messages.
+	 * @param [in] enable Enables asynchronous logging if non-zero, disables it otherwise
+	 * @param [in] capacity Maximum number of queued messages (rounded up to a power of two)
+	 * @sa setAsyncLogging()
+	 */
+	CADET_API void cadetSetAsyncLogging(int enable, unsigned int capacity);
+
+	/**
+	 * @brief Waits until all pending log messages have been delivered to the log receiver
+	 */
+	CADET_API void cadetFlushLog();
 }
 
 #endif  // LIBCADET_LOGGING_HPP_
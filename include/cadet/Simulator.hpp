@@ -34,6 +34,62 @@ class IModelSystem;
 class ISolutionRecorder;
 class IParameterProvider;
 class INotificationCallback;
+class IEventHandler;
+
+/**
+ * @brief Time series of time integrator and linear solver statistics
+ * @details Each entry corresponds to one internal time step of the time integrator or to an event that interrupts
+ *          a step. Counters contain the increment since the previous entry. The
+ *          sensitivity counters are only filled if forward sensitivities are computed.
+ *
+ *          Per unit operation counters are stored in row-major matrices with one row per entry and one column
+ *          per unit operation (in order of IModelSystem::getModel()).
+ */
+struct SolverStatistics
+{
+	std::vector<double> time; //!< Simulation time of the entries
+	std::vector<double> wallTime; //!< Elapsed wall-clock time since the previous entry in seconds
+	std::vector<double> lastStepSize; //!< Size of the last internal time step
+	std::vector<double> nextStepSize; //!< Size of the next internal time step to be attempted
+	std::vector<int> numSteps; //!< Number of internal time steps
+	std::vector<int> numResEvals; //!< Number of residual evaluations
+	std::vector<int> numNewtonIters; //!< Number of Newton iterations
+	std::vector<int> numConvFails; //!< Number of Newton convergence failures
+	std::vector<int> numErrTestFails; //!< Number of local error test failures
+	std::vector<int> numSensResEvals; //!< Number of sensitivity residual evaluations
+	std::vector<int> numSensNewtonIters; //!< Number of sensitivity Newton iterations
+	std::vector<int> numSensConvFails; //!< Number of sensitivity Newton convergence failures
+	std::vector<int> numSensErrTestFails; //!< Number of sensitivity local error test failures
+	std::vector<int> numCouplingGmresIterations; //!< Number of GMRES iterations of the unit operation coupling
+	unsigned int numUnits; //!< Number of unit operations (columns of the per unit matrices)
+	std::vector<int> unitOpIds; //!< Unit operation index of each column
+	std::vector<int> numFactorizations; //!< Number of Jacobian factorizations of each unit operation (row-major matrix)
+	std::vector<int> numGmresIterations; //!< Number of GMRES iterations of each unit operation (row-major matrix)
+
+	SolverStatistics() : numUnits(0) { }
+
+	inline std::size_t size() const CADET_NOEXCEPT { return time.size(); }
+
+	inline void clear()
+	{
+		time.clear();
+		wallTime.clear();
+		lastStepSize.clear();
+		nextStepSize.clear();
+		numSteps.clear();
+		numResEvals.clear();
+		numNewtonIters.clear();
+		numConvFails.clear();
+		numErrTestFails.clear();
+		numSensResEvals.clear();
+		numSensNewtonIters.clear();
+		numSensConvFails.clear();
+		numSensErrTestFails.clear();
+		numCouplingGmresIterations.clear();
+		numFactorizations.clear();
+		numGmresIterations.clear();
+	}
+};
 
 enum class ConsistentInitialization : int
 {
@@ -498,6 +554,50 @@ public:
 	 */
 	virtual const std::vector<double const*> getLastSensitivityDerivatives(unsigned int& len) const = 0;
 
+	/**
+	 * @brief Sets the file to which checkpoints are written during time integration
+	 * @details A checkpoint is written whenever the time integrator is restarted at a discontinuous
+	 *          section transition. It contains the section index, the section start time, the state
+	 *          vector, its time derivative, and all forward sensitivities (before consistent initialization).
+	 *          Since the time integrator discards its history at these points, a simulation resumed from a
+	 *          checkpoint (see resumeFromCheckpoint()) reproduces the uninterrupted simulation. Writing
+	 *          checkpoints does not alter the time integration. Checkpoints are first written to a temporary file, which then replaces the previous checkpoint.
+	 *          Thus, the file always holds a complete checkpoint even if the process is killed while writing.
+	 *
+	 *          Passing @c NULL or an empty string disables checkpoints (default).
+	 * @param [in] fileName Name of the checkpoint file
+	 */
+	virtual void setCheckpointFile(const char* fileName) = 0;
+
+	/**
+	 * @brief Sets the minimum wall clock time between two checkpoints
+	 * @details Checkpoints are only written at discontinuous section transitions (see setCheckpointFile()).
+	 *          A transition is skipped if less than @p interval seconds (wall clock time) have passed since
+	 *          the last checkpoint or the start of the time integration. This reduces the I/O of simulations
+	 *          with many short sections. The time integration itself is not affected.
+	 *
+	 *          Has no effect if no checkpoint file is set (see setCheckpointFile()).
+	 * @param [in] interval Wall clock time in seconds, @c 0 writes a checkpoint at every transition (default)
+	 * @throws InvalidParameterException if @p interval is negative
+	 */
+	virtual void setCheckpointInterval(double interval) = 0;
+
+	/**
+	 * @brief Resumes the simulation from a checkpoint in the next call to integrate()
+	 * @details Loads the state vector, its time derivative, and the forward sensitivities from
+	 *          the given checkpoint file written by a previous run (see setCheckpointFile()). The next call
+	 *          to integrate() starts at the section stored in the checkpoint instead of the first section.
+	 *          Solutions are only recorded from that section on, the solutions recorded before the checkpoint
+	 *          are not restored.
+	 *
+	 *          The simulation has to be set up (model, section times, sensitive parameters) exactly as in the
+	 *          run that created the checkpoint. The number of DOFs, the number of sensitive parameters, and the
+	 *          section start time are checked.
+	 * @param [in] fileName Name of the checkpoint file
+	 * @throws InvalidParameterException if the file cannot be read or does not match the current setup
+	 */
+	virtual void resumeFromCheckpoint(const char* fileName) = 0;
+
 	/**
 	 * @brief Returns the simulated model
 	 * @return Simulated model or @c NULL
@@ -709,6 +809,21 @@ public:
 	 */
 	virtual void setMaxSensNewtonIteration(unsigned int nIter) = 0;
 
+	/**
+	 * @brief Selects whether forward sensitivity systems are corrected simultaneously with the original system
+	 * @details By default (@c false), the staggered corrector method of IDAS is used. Each time step,
+	 *          the original system is solved first and, afterwards, the forward sensitivity systems
+	 *          are corrected using separate Newton iterations (see setMaxSensNewtonIteration()).
+	 *          In the simultaneous corrector method, original system and forward sensitivity systems
+	 *          are corrected together in one Newton iteration (see setMaxNewtonIteration()), which
+	 *          reuses the Jacobian factorization for all right hand sides of an iteration.
+	 *          
+	 *          The setting takes effect when the next section is started.
+	 * 
+	 * @param [in] simultaneous Determines whether the simultaneous corrector method is used
+	 */
+	virtual void setSimultaneousSensitivityCorrector(bool simultaneous) = 0;
+
 	/**
 	 * @brief Returns the elapsed time of the last simulation run in seconds
 	 * @return Elapsed time the last call of integrate() took in seconds
@@ -721,11 +836,36 @@ public:
 	 */
 	virtual double totalSimulationDuration() const CADET_NOEXCEPT = 0;
 
+	/**
+	 * @brief Enables or disables recording of time integrator and linear solver statistics
+	 * @details If enabled, statistics are recorded after each internal time step during the final
+	 *          integration run of integrate() (i.e., excluding cyclic steady state cycles). Hence,
+	 *          user specified solution times are interpolated as with dense output.
+	 *          The statistics are reset at the beginning of each call to integrate().
+	 * @param [in] enabled Determines whether statistics are recorded
+	 */
+	virtual void setSolverStatisticsRecording(bool enabled) CADET_NOEXCEPT = 0;
+
+	/**
+	 * @brief Returns the statistics recorded during the last call to integrate()
+	 * @return Time series of solver statistics
+	 * @sa setSolverStatisticsRecording()
+	 */
+	virtual const SolverStatistics& solverStatistics() const CADET_NOEXCEPT = 0;
+
 	/**
 	 * @brief Sets the receiver for notifications
 	 * @param[in] nc Object to receive notifications or @c nullptr to disable notifications
 	 */
 	virtual void setNotificationCallback(INotificationCallback* nc) CADET_NOEXCEPT = 0;
+
+	/**
+	 * @brief Sets the handler for state dependent events
+	 * @details The event functions of the handler are monitored by the time integrator (rootfinding).
+	 *          The handler is not owned by the simulator.
+	 * @param[in] eh Event handler or @c nullptr to disable events
+	 */
+	virtual void setEventHandler(IEventHandler* eh) CADET_NOEXCEPT = 0;
 };
 
 } // namespace cadet
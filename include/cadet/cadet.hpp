@@ -46,3 +46,4 @@
 #include "cadet/Simulator.hpp"
 #include "cadet/FactoryFuncs.hpp"
 #include "cadet/Notification.hpp"
+#include "cadet/EventHandler.hpp"
@@ -0,0 +1,124 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file 
+ * Defines a read-only ParameterProvider that uses a compact JSON representation.
+ */
+
+#ifndef CADET_COMPACTJSONPARAMETERPROVIDER_HPP_
+#define CADET_COMPACTJSONPARAMETERPROVIDER_HPP_
+
+#include "cadet/ParameterProvider.hpp"
+#include "common/CompilerSpecific.hpp"
+
+#include <string>
+#include <vector>
+#include <stack>
+#include <cstdint>
+
+namespace cadet
+{
+
+/**
+ * @brief Read-only ParameterProvider for large JSON inputs
+ * @details The JSON document is parsed in a single pass into a compact tree. In contrast to
+ *          JsonParameterProvider, arrays of numbers are stored in contiguous memory and returned
+ *          by a single copy. Numbers are converted by an exact fast path for short decimals and
+ *          fall back to the C library otherwise.
+ *
+ *          Semantics of the getters (e.g., conversion of single element arrays to scalars and
+ *          of booleans to integers) follow JsonParameterProvider. Errors are reported by
+ *          io::IOException.
+ */
+class CompactJsonParameterProvider : public cadet::IParameterProvider
+{
+public:
+
+	CompactJsonParameterProvider(const char* data);
+	CompactJsonParameterProvider(const std::string& data);
+	CompactJsonParameterProvider(CompactJsonParameterProvider&& cpy) CADET_NOEXCEPT;
+
+	virtual ~CompactJsonParameterProvider() CADET_NOEXCEPT;
+
+	CompactJsonParameterProvider& operator=(CompactJsonParameterProvider&& cpy) CADET_NOEXCEPT;
+
+	virtual double getDouble(const std::string& paramName);
+	virtual int getInt(const std::string& paramName);
+	virtual uint64_t getUint64(const std::string& paramName);
+	virtual bool getBool(const std::string& paramName);
+	virtual std::string getString(const std::string& paramName);
+	virtual std::vector<double> getDoubleArray(const std::string& paramName);
+	virtual std::vector<int> getIntArray(const std::string& paramName);
+	virtual std::vector<uint64_t> getUint64Array(const std::string& paramName);
+	virtual std::vector<bool> getBoolArray(const std::string& paramName);
+	virtual std::vector<std::string> getStringArray(const std::string& paramName);
+	virtual bool exists(const std::string& paramName);
+	virtual bool isArray(const std::string& paramName);
+	virtual std::size_t numElements(const std::string& paramName);
+	virtual void pushScope(const std::string& scope);
+	virtual void popScope();
+
+	static CompactJsonParameterProvider fromFile(const std::string& fileName);
+
+	/**
+	 * @brief Node of the compact JSON tree
+	 * @details Arrays that only contain numbers or booleans are stored in @c integers (as long as all
+	 *          elements are integral) or @c reals. All other arrays store their elements in @c children.
+	 */
+	struct Node
+	{
+		enum class Type : uint8_t
+		{
+			Null,
+			Bool,
+			Int,
+			Double,
+			String,
+			Object,
+			Array,
+			IntArray,
+			DoubleArray
+		};
+
+		Type type;
+		bool isUnsigned; //!< Determines whether integers are unsigned (only relevant if they exceed the signed range)
+		int64_t integer; //!< Value of Bool and Int nodes
+		double real; //!< Value of Double nodes
+		std::string string; //!< Value of String nodes
+		std::vector<int64_t> integers; //!< Elements of IntArray nodes
+		std::vector<double> reals; //!< Elements of DoubleArray nodes
+		std::vector<std::string> keys; //!< Sorted keys of Object nodes
+		std::vector<Node> children; //!< Members of Object nodes (in order of @c keys) and elements of Array nodes
+
+		Node() : type(Type::Null), isUnsigned(false), integer(0), real(0.0) { }
+
+		std::size_t size() const CADET_NOEXCEPT;
+		Node const* find(const std::string& key) const;
+	};
+
+private:
+	CompactJsonParameterProvider();
+	CompactJsonParameterProvider(const CompactJsonParameterProvider& cpy) = delete;
+	CompactJsonParameterProvider& operator=(const CompactJsonParameterProvider& cpy) = delete;
+
+	void parse(const char* data, std::size_t len);
+	const Node& at(const std::string& paramName) const;
+
+	Node _root;
+	std::stack<Node const*> _opened;
+	std::string _scopePath;
+};
+
+} // namespace cadet
+
+#endif  // CADET_COMPACTJSONPARAMETERPROVIDER_HPP_
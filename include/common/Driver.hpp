@@ -22,10 +22,12 @@
 #include <vector>
 #include <iomanip>
 #include <sstream>
+#include <algorithm>
 
 #include "cadet/cadet.hpp"
 
 #include "common/SolutionRecorderImpl.hpp"
+#include "io/StorageOptions.hpp"
 
 
 namespace cadet
@@ -96,6 +98,108 @@ void readDataOutputConfig(ParamProvider_t& pp, StorageConfig_t& cfg, const std::
 		cfg.storeVolume = pp.getBool("WRITE_" + dataType + "_VOLUME");
 	else
 		cfg.storeVolume = false;
+
+	if (pp.exists("WRITE_" + dataType + "_SOLID_PARTICLE_AVERAGE"))
+		cfg.storeSolidParticleAverage = pp.getBool("WRITE_" + dataType + "_SOLID_PARTICLE_AVERAGE");
+	else
+		cfg.storeSolidParticleAverage = false;
+
+	if (pp.exists("WRITE_" + dataType + "_SOLID_COLUMN_AVERAGE"))
+		cfg.storeSolidColumnAverage = pp.getBool("WRITE_" + dataType + "_SOLID_COLUMN_AVERAGE");
+	else
+		cfg.storeSolidColumnAverage = false;
+}
+
+template <class ParamProvider_t>
+std::vector<unsigned int> readRecordedIndices(ParamProvider_t& pp, const std::string& name)
+{
+	if (!pp.exists(name))
+		return std::vector<unsigned int>(0);
+
+	const std::vector<int> idx = pp.getIntArray(name);
+	std::vector<unsigned int> result(idx.size());
+	for (std::size_t i = 0; i < idx.size(); ++i)
+	{
+		if (idx[i] < 0)
+			throw cadet::InvalidParameterException("Field " + name + " contains negative indices");
+		result[i] = static_cast<unsigned int>(idx[i]);
+	}
+	return result;
+}
+
+template <class ParamProvider_t>
+void readStorageOptions(ParamProvider_t& pp, cadet::io::StorageOptions& opts)
+{
+	if (pp.exists("COMPRESSION"))
+	{
+		const std::string comp = pp.getString("COMPRESSION");
+		if (comp == "NONE")
+			opts.compression = cadet::io::Compression::None;
+		else if (comp == "DEFLATE")
+			opts.compression = cadet::io::Compression::Deflate;
+		else if (comp == "LZ4")
+			opts.compression = cadet::io::Compression::LZ4;
+		else if (comp == "ZSTD")
+			opts.compression = cadet::io::Compression::Zstd;
+		else
+			throw cadet::InvalidParameterException("Unknown compression " + comp + " in field COMPRESSION");
+	}
+
+	if (pp.exists("COMPRESSION_LEVEL"))
+		opts.compressionLevel = std::max(pp.getInt("COMPRESSION_LEVEL"), -1);
+
+	if (pp.exists("SHUFFLE"))
+		opts.shuffle = pp.getBool("SHUFFLE");
+
+	if (pp.exists("CHUNK_SIZE"))
+	{
+		const int chunkSize = pp.getInt("CHUNK_SIZE");
+		if (chunkSize < 0)
+			throw cadet::InvalidParameterException("Field CHUNK_SIZE has to be non-negative");
+		opts.chunkSize = static_cast<std::size_t>(chunkSize);
+	}
+
+	if (pp.exists("PRECISION"))
+	{
+		const std::string prec = pp.getString("PRECISION");
+		if (prec == "DOUBLE")
+			opts.precision = cadet::io::Precision::Double;
+		else if (prec == "SINGLE")
+			opts.precision = cadet::io::Precision::Single;
+		else
+			throw cadet::InvalidParameterException("Unknown precision " + prec + " in field PRECISION");
+	}
+
+	if (pp.exists("QUANTIZATION_DIGITS"))
+		opts.quantizationDigits = std::max(pp.getInt("QUANTIZATION_DIGITS"), -1);
+}
+
+template <class ParamProvider_t>
+void readStorageConfig(ParamProvider_t& pp, cadet::io::StorageOptions& defaultOpts, std::vector<cadet::io::DatasetStorageOptions>& datasetOpts)
+{
+	defaultOpts = cadet::io::StorageOptions();
+	readStorageOptions(pp, defaultOpts);
+
+	// Dataset specific options override the default options
+	datasetOpts.clear();
+	std::ostringstream oss;
+	for (unsigned int i = 0; ; ++i)
+	{
+		oss.str("");
+		oss << "storage_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << i;
+		if (!pp.exists(oss.str()))
+			break;
+
+		pp.pushScope(oss.str());
+
+		cadet::io::DatasetStorageOptions dso;
+		dso.prefix = pp.getString("DATASET_PREFIX");
+		dso.options = defaultOpts;
+		readStorageOptions(pp, dso.options);
+		datasetOpts.push_back(dso);
+
+		pp.popScope();
+	}
 }
 
 template <class ParamProvider_t>
@@ -158,6 +262,24 @@ void configureSystemRecorder(cadet::InternalStorageSystemRecorder& recorder, Par
 		if (pp.exists("WRITE_COORDINATES"))
 			subRec->storeCoordinates(pp.getBool("WRITE_COORDINATES"));
 
+		subRec->recordAxialCells(detail::readRecordedIndices(pp, "RECORD_AXIAL_CELLS"));
+		subRec->recordParticleShells(detail::readRecordedIndices(pp, "RECORD_PARTICLE_SHELLS"));
+		subRec->recordComponents(detail::readRecordedIndices(pp, "RECORD_COMPONENTS"));
+
+		int recordEvery = 1;
+		if (pp.exists("RECORD_EVERY"))
+			recordEvery = pp.getInt("RECORD_EVERY");
+		if (recordEvery < 1)
+			throw cadet::InvalidParameterException("Field RECORD_EVERY has to be positive");
+
+		double recordMinDt = 0.0;
+		if (pp.exists("RECORD_MIN_DT"))
+			recordMinDt = pp.getDouble("RECORD_MIN_DT");
+		if (recordMinDt < 0.0)
+			throw cadet::InvalidParameterException("Field RECORD_MIN_DT has to be non-negative");
+
+		subRec->decimation(static_cast<unsigned int>(recordEvery), recordMinDt);
+
 		subRec->splitComponents(splitComponents);
 		subRec->splitPorts(splitPorts);
 		subRec->treatSingleAsMultiPortUnitOps(singleAsMultiPort);
@@ -194,7 +316,7 @@ void readSensitivityInitialState(ParamProvider_t& pp, const char* prefix, std::v
 class Driver
 {
 public:
-	Driver() : _sim(nullptr), _builder(nullptr), _storage(nullptr), _writeLastState(false), _writeLastStateSens(false)
+	Driver() : _sim(nullptr), _builder(nullptr), _storage(nullptr), _writeLastState(false), _writeLastStateSens(false), _writeStatistics(false)
 	{
 		_builder = cadetCreateModelBuilder();
 	}
@@ -462,6 +584,15 @@ public:
 			_writeLastStateSens = pp.getBool("WRITE_SENS_LAST");
 		else
 			_writeLastStateSens = false;
+
+		if (pp.exists("WRITE_STATISTICS"))
+			_writeStatistics = pp.getBool("WRITE_STATISTICS");
+		else
+			_writeStatistics = false;
+
+		_sim->setSolverStatisticsRecording(_writeStatistics);
+
+		detail::readStorageConfig(pp, _storageOptions, _datasetStorageOptions);
 		
 		pp.popScope(); // scope return
 
@@ -497,6 +628,19 @@ public:
 		writer.extendibleFields(false);
 		writer.compressFields(true);
 
+		// Reduced precision and quantization only apply to solution and sensitivity datasets,
+		// all other datasets (time points, coordinates, last states, statistics) are stored losslessly
+		const cadet::io::StorageOptions losslessOptions = cadet::io::losslessStorageOptions(_storageOptions);
+		std::vector<cadet::io::DatasetStorageOptions> losslessDatasetOptions = _datasetStorageOptions;
+		for (cadet::io::DatasetStorageOptions& dso : losslessDatasetOptions)
+			dso.options = cadet::io::losslessStorageOptions(dso.options);
+
+		// Time points are written along with the solution, the last entry wins on equal prefix length
+		std::vector<cadet::io::DatasetStorageOptions> solutionDatasetOptions = _datasetStorageOptions;
+		solutionDatasetOptions.push_back(cadet::io::DatasetStorageOptions{"SOLUTION_TIMES", losslessOptions});
+
+		writer.storageOptions(losslessOptions, losslessDatasetOptions);
+
 		writer.pushGroup("output");
 
 		if (_storage->anyUnitStoresCoordinates())
@@ -506,6 +650,8 @@ public:
 			writer.popGroup();
 		}
 
+		writer.storageOptions(_storageOptions, solutionDatasetOptions);
+
 		writer.pushGroup("solution");
 		_storage->writeSolution(writer);
 		writer.popGroup();
@@ -517,6 +663,8 @@ public:
 			writer.popGroup();
 		}
 
+		writer.storageOptions(losslessOptions, losslessDatasetOptions);
+
 		if (_writeLastState)
 		{
 			unsigned int len = 0;
@@ -547,6 +695,36 @@ public:
 			}
 		}
 
+		if (_writeStatistics && (_sim->solverStatistics().size() > 0))
+		{
+			const cadet::SolverStatistics& stats = _sim->solverStatistics();
+
+			writer.pushGroup("statistics");
+			writer.vector("TIME", stats.time);
+			writer.vector("WALL_TIME", stats.wallTime);
+			writer.vector("LAST_STEP_SIZE", stats.lastStepSize);
+			writer.vector("NEXT_STEP_SIZE", stats.nextStepSize);
+			writer.vector("NUM_STEPS", stats.numSteps);
+			writer.vector("NUM_RES_EVALS", stats.numResEvals);
+			writer.vector("NUM_NEWTON_ITERS", stats.numNewtonIters);
+			writer.vector("NUM_CONV_FAILS", stats.numConvFails);
+			writer.vector("NUM_ERROR_TEST_FAILS", stats.numErrTestFails);
+
+			if (!stats.numSensResEvals.empty())
+			{
+				writer.vector("NUM_SENS_RES_EVALS", stats.numSensResEvals);
+				writer.vector("NUM_SENS_NEWTON_ITERS", stats.numSensNewtonIters);
+				writer.vector("NUM_SENS_CONV_FAILS", stats.numSensConvFails);
+				writer.vector("NUM_SENS_ERROR_TEST_FAILS", stats.numSensErrTestFails);
+			}
+
+			writer.vector("NUM_COUPLING_GMRES_ITERS", stats.numCouplingGmresIterations);
+			writer.vector("UNIT_OPERATIONS", stats.unitOpIds);
+			writer.matrix("NUM_FACTORIZATIONS", stats.size(), stats.numUnits, stats.numFactorizations);
+			writer.matrix("NUM_GMRES_ITERS", stats.size(), stats.numUnits, stats.numGmresIterations);
+			writer.popGroup();
+		}
+
 		writer.popGroup();
 
 		if (writer.exists("meta"))
@@ -574,6 +752,11 @@ public:
 			writer.scalar("FILE_FORMAT", 40000);
 
 		writer.popGroup();
+
+		if (writer.compressionUnavailable(cadet::io::Compression::LZ4))
+			LOG(Warning) << "HDF5 filter plugin for LZ4 compression is not available, falling back to deflate with byte shuffling";
+		if (writer.compressionUnavailable(cadet::io::Compression::Zstd))
+			LOG(Warning) << "HDF5 filter plugin for Zstd compression is not available, falling back to deflate with byte shuffling";
 	}
 
 	/**
@@ -591,6 +774,12 @@ public:
 
 	inline void setWriteLastState(bool writeLastState) CADET_NOEXCEPT { _writeLastState = writeLastState; }
 	inline void setWriteLastStateSens(bool writeLastState) CADET_NOEXCEPT { _writeLastStateSens = writeLastState; }
+	inline void setWriteStatistics(bool writeStatistics) CADET_NOEXCEPT
+	{
+		_writeStatistics = writeStatistics;
+		if (_sim)
+			_sim->setSolverStatisticsRecording(writeStatistics);
+	}
 	inline void setWriteSolutionTimes(bool solTimes) CADET_NOEXCEPT
 	{
 		if (_storage)
@@ -607,6 +796,10 @@ protected:
 
 	bool _writeLastState;
 	bool _writeLastStateSens;
+	bool _writeStatistics; //!< Determines whether solver statistics are recorded and written
+
+	cadet::io::StorageOptions _storageOptions; //!< Default storage options of written datasets
+	std::vector<cadet::io::DatasetStorageOptions> _datasetStorageOptions; //!< Storage options of datasets with given name prefix
 
 	/**
 	 * @brief Sets section times and section continuity from the given parameter provider
@@ -0,0 +1,358 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file 
+ * Provides hardware performance counters based on the Linux perf_event_open() interface.
+ * Counters are opened lazily for each thread and only count events of the calling thread
+ * in user space. On other platforms, or if the kernel denies access (see
+ * @c /proc/sys/kernel/perf_event_paranoid), all counters are reported as unavailable.
+ */
+
+#ifndef CADET_PERFCOUNTERS_HPP_
+#define CADET_PERFCOUNTERS_HPP_
+
+#include <atomic>
+#include <cstdint>
+
+#ifdef __linux__
+	#include <fstream>
+	#include <string>
+	#include <cstring>
+
+	#include <unistd.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+	#include <linux/perf_event.h>
+#endif
+
+namespace cadet
+{
+
+namespace perf
+{
+
+	/**
+	 * @brief Hardware events that are counted
+	 * @details The floating point events are only available on Intel processors (Skylake or newer).
+	 *          The ratio of packed to all floating point instructions measures vectorization.
+	 */
+	enum class Event : unsigned int
+	{
+		Cycles = 0, //!< CPU cycles
+		Instructions, //!< Retired instructions
+		CacheReferences, //!< Last level cache references
+		CacheMisses, //!< Last level cache misses
+		L1DReadMisses, //!< Level 1 data cache read misses
+		FpScalar, //!< Retired scalar double precision floating point instructions
+		FpPacked, //!< Retired packed (SSE, AVX, AVX-512) double precision floating point instructions
+	};
+
+	/**
+	 * @brief Number of counted events
+	 */
+	const unsigned int numEvents = 7;
+
+	/**
+	 * @brief Number of counter groups that are scheduled independently by the kernel
+	 */
+	const unsigned int numGroups = 2;
+
+	/**
+	 * @brief Returns the index of the counter group an event belongs to
+	 * @details Cycles, instructions, and cache events form the first group, the floating point
+	 *          events the second one.
+	 * @param [in] idx Index of the event
+	 * @return Index of the group
+	 */
+	inline unsigned int eventGroup(unsigned int idx)
+	{
+		return (idx < static_cast<unsigned int>(Event::FpScalar)) ? 0 : 1;
+	}
+
+	/**
+	 * @brief Snapshot of the counter values of the calling thread
+	 * @details The values are not scaled, since scaling only yields meaningful results for differences
+	 *          of snapshots (see CounterAccumulator::add()).
+	 */
+	struct Snapshot
+	{
+		std::uint64_t values[numEvents]; //!< Raw counter values
+		std::uint64_t timeEnabled[numGroups]; //!< Time the group of counters has been enabled
+		std::uint64_t timeRunning[numGroups]; //!< Time the group of counters has actually been counting
+	};
+
+#ifdef __linux__
+
+	/**
+	 * @brief Performance counters of the calling thread
+	 * @details The counters are organized in two groups that are scheduled as a whole by the kernel.
+	 *          If the kernel multiplexes the groups, each group only counts for a fraction of the time
+	 *          it is enabled. Both times are recorded with the raw values, so that differences can be
+	 *          extrapolated. Events that cannot be opened are reported as unavailable.
+	 */
+	class ThreadCounters
+	{
+	public:
+
+		/**
+		 * @brief Returns the counters of the calling thread, which are opened on first use
+		 * @return Counters of the calling thread
+		 */
+		static ThreadCounters& instance()
+		{
+			thread_local ThreadCounters tc;
+			return tc;
+		}
+
+		/**
+		 * @brief Reads the current values of all counters
+		 * @param [out] snap Raw counter values, unavailable events are set to @c 0
+		 */
+		inline void read(Snapshot& snap) const
+		{
+			for (unsigned int i = 0; i < numEvents; ++i)
+				snap.values[i] = 0;
+
+			readGroup(_generic, 0, snap);
+			readGroup(_floatingPoint, 1, snap);
+		}
+
+		/**
+		 * @brief Returns whether the given event is counted
+		 * @param [in] idx Index of the event
+		 * @return @c true if the event is counted, otherwise @c false
+		 */
+		inline bool available(unsigned int idx) const { return _available[idx]; }
+
+		~ThreadCounters()
+		{
+			closeGroup(_generic);
+			closeGroup(_floatingPoint);
+		}
+
+	private:
+
+		static const unsigned int maxGroupSize = 5;
+
+		/**
+		 * @brief Group of counters that are scheduled together
+		 */
+		struct Group
+		{
+			int fds[maxGroupSize]; //!< File descriptors of the counters, the first one is the group leader
+			unsigned int events[maxGroupSize]; //!< Event index each counter contributes to
+			unsigned int num; //!< Number of opened counters
+		};
+
+		ThreadCounters()
+		{
+			for (unsigned int i = 0; i < numEvents; ++i)
+				_available[i] = false;
+
+			_generic.num = 0;
+			_floatingPoint.num = 0;
+
+			addCounter(_generic, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, Event::Cycles);
+			addCounter(_generic, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, Event::Instructions);
+			addCounter(_generic, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES, Event::CacheReferences);
+			addCounter(_generic, PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, Event::CacheMisses);
+			addCounter(_generic, PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16), Event::L1DReadMisses);
+			enableGroup(_generic);
+
+			// FP_ARITH_INST_RETIRED (event 0xC7) with umasks for scalar, 128, 256, and 512 bit packed double precision
+			if (isIntel())
+			{
+				addCounter(_floatingPoint, PERF_TYPE_RAW, 0x01C7, Event::FpScalar);
+				addCounter(_floatingPoint, PERF_TYPE_RAW, 0x04C7, Event::FpPacked);
+				addCounter(_floatingPoint, PERF_TYPE_RAW, 0x10C7, Event::FpPacked);
+				addCounter(_floatingPoint, PERF_TYPE_RAW, 0x40C7, Event::FpPacked);
+				enableGroup(_floatingPoint);
+			}
+		}
+
+		static bool isIntel()
+		{
+			std::ifstream ifs("/proc/cpuinfo");
+			std::string line;
+			while (std::getline(ifs, line))
+			{
+				if (line.compare(0, 9, "vendor_id") == 0)
+					return line.find("GenuineIntel") != std::string::npos;
+			}
+			return false;
+		}
+
+		void addCounter(Group& grp, std::uint32_t type, std::uint64_t config, Event evt)
+		{
+			struct perf_event_attr attr;
+			std::memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.type = type;
+			attr.config = config;
+			attr.disabled = (grp.num == 0) ? 1 : 0;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+			const int leader = (grp.num == 0) ? -1 : grp.fds[0];
+			const int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0));
+			if (fd < 0)
+				return;
+
+			grp.fds[grp.num] = fd;
+			grp.events[grp.num] = static_cast<unsigned int>(evt);
+			++grp.num;
+			_available[static_cast<unsigned int>(evt)] = true;
+		}
+
+		static void enableGroup(const Group& grp)
+		{
+			if (grp.num == 0)
+				return;
+
+			ioctl(grp.fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+			ioctl(grp.fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+		}
+
+		static void closeGroup(const Group& grp)
+		{
+			for (unsigned int i = 0; i < grp.num; ++i)
+				close(grp.fds[i]);
+		}
+
+		static void readGroup(const Group& grp, unsigned int idxGroup, Snapshot& snap)
+		{
+			snap.timeEnabled[idxGroup] = 0;
+			snap.timeRunning[idxGroup] = 0;
+
+			if (grp.num == 0)
+				return;
+
+			// Layout of PERF_FORMAT_GROUP: nr, time_enabled, time_running, values[nr]
+			std::uint64_t buffer[3 + maxGroupSize];
+			const ssize_t bytes = ::read(grp.fds[0], buffer, sizeof(buffer));
+			if ((bytes < static_cast<ssize_t>(3 * sizeof(std::uint64_t))) || (buffer[0] != grp.num))
+				return;
+
+			snap.timeEnabled[idxGroup] = buffer[1];
+			snap.timeRunning[idxGroup] = buffer[2];
+			for (unsigned int i = 0; i < grp.num; ++i)
+				snap.values[grp.events[i]] += buffer[3 + i];
+		}
+
+		Group _generic; //!< Cycles, instructions, and cache events
+		Group _floatingPoint; //!< Floating point events
+		bool _available[numEvents]; //!< Determines which events are counted
+	};
+
+#else
+
+	/**
+	 * @brief Stub for platforms without perf_event_open()
+	 */
+	class ThreadCounters
+	{
+	public:
+		static ThreadCounters& instance()
+		{
+			static ThreadCounters tc;
+			return tc;
+		}
+
+		inline void read(Snapshot& snap) const
+		{
+			for (unsigned int i = 0; i < numEvents; ++i)
+				snap.values[i] = 0;
+
+			for (unsigned int i = 0; i < numGroups; ++i)
+			{
+				snap.timeEnabled[i] = 0;
+				snap.timeRunning[i] = 0;
+			}
+		}
+
+		inline bool available(unsigned int) const { return false; }
+	};
+
+#endif
+
+	/**
+	 * @brief Takes a snapshot of the counters of the calling thread
+	 * @return Counter values
+	 */
+	inline Snapshot takeSnapshot()
+	{
+		Snapshot snap;
+		ThreadCounters::instance().read(snap);
+		return snap;
+	}
+
+	/**
+	 * @brief Accumulates counter differences over multiple measured regions and threads
+	 * @details Each region is measured on the thread that executes it, so concurrently
+	 *          executing regions on different threads are summed up.
+	 */
+	class CounterAccumulator
+	{
+	public:
+		CounterAccumulator()
+		{
+			for (unsigned int i = 0; i < numEvents; ++i)
+				_total[i].store(0, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Adds the events that occurred on the calling thread since the given snapshot
+		 * @details If the kernel has multiplexed a group of counters during the region, the number of
+		 *          events is extrapolated by the ratio of the time the group has been enabled to the
+		 *          time it has been running in the region.
+		 * @param [in] begin Snapshot taken on the calling thread at the beginning of the region
+		 */
+		inline void add(const Snapshot& begin)
+		{
+			const Snapshot end = takeSnapshot();
+			for (unsigned int i = 0; i < numEvents; ++i)
+			{
+				const unsigned int grp = eventGroup(i);
+				const std::uint64_t enabled = end.timeEnabled[grp] - begin.timeEnabled[grp];
+				const std::uint64_t running = end.timeRunning[grp] - begin.timeRunning[grp];
+				const std::uint64_t delta = end.values[i] - begin.values[i];
+
+				if ((running > 0) && (running < enabled))
+					_total[i].fetch_add(static_cast<std::uint64_t>(static_cast<double>(delta) * static_cast<double>(enabled) / static_cast<double>(running)), std::memory_order_relaxed);
+				else
+					_total[i].fetch_add(delta, std::memory_order_relaxed);
+			}
+		}
+
+		/**
+		 * @brief Returns the accumulated number of events
+		 * @param [in] idx Index of the event
+		 * @return Number of events or @c -1 if the event is not available
+		 */
+		inline double total(unsigned int idx) const
+		{
+			if (!ThreadCounters::instance().available(idx))
+				return -1.0;
+			return static_cast<double>(_total[idx].load(std::memory_order_relaxed));
+		}
+
+	private:
+		std::atomic<std::uint64_t> _total[numEvents];
+	};
+
+} // namespace perf
+
+} // namespace cadet
+
+#endif  // CADET_PERFCOUNTERS_HPP_
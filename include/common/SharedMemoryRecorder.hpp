@@ -0,0 +1,428 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file 
+ * Provides a solution recorder that publishes the solution in a shared memory ring buffer.
+ *
+ * The shared memory segment starts with a shm::Header, which is followed by shm::Header::numUnits
+ * shm::UnitLayout descriptors. The ring buffer of shm::Header::capacity slots starts at byte offset
+ * shm::Header::dataOffset and each slot occupies shm::Header::slotSize bytes. A slot starts with a
+ * shm::SlotHeader followed by the data of the unit operations at the byte offsets given in their
+ * shm::UnitLayout descriptors. The outlet is stored in port-major ordering (i.e., all components of
+ * the first port, then all components of the second port, etc.). The bulk volume is stored in the
+ * ordering of ISolutionExporter::concentrationOrdering(), which is also given in the descriptor.
+ *
+ * Time step @c k (zero-based) is written to slot <tt>k % capacity</tt>. A consumer reads a slot as follows:
+ *   1. Load the sequence number of the slot (acquire), it is @c k + 1 if the slot holds time step @c k
+ *   2. Copy the data out of the slot
+ *   3. Load the sequence number again, the copy is valid if it has not changed
+ *
+ * The writer sets the sequence number to @c 0 while a slot is being written. The total number of completed
+ * time steps is published in shm::Header::numWritten, which is reset to @c 0 when a new simulation starts.
+ */
+
+#ifndef LIBCADET_SHAREDMEMORYRECORDER_HPP_
+#define LIBCADET_SHAREDMEMORYRECORDER_HPP_
+
+#include "cadet/cadetCompilerInfo.hpp"
+#include "cadet/SolutionRecorder.hpp"
+#include "cadet/SolutionExporter.hpp"
+#include "io/IOException.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#if defined(__unix__) || defined(__APPLE__)
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+
+	#define CADET_SHARED_MEMORY_RECORDER_AVAILABLE
+#endif
+
+namespace cadet
+{
+
+namespace shm
+{
+
+	const std::uint32_t magic = 0x4D485343; //!< Identifies a CADET shared memory segment ("CSHM")
+	const std::uint32_t version = 1; //!< Version of the memory layout
+
+	static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Shared memory recorder requires lock-free 64 bit atomics");
+	static_assert(sizeof(std::atomic<std::uint64_t>) == sizeof(std::uint64_t), "Unexpected size of 64 bit atomics");
+
+	/**
+	 * @brief Header at the beginning of the shared memory segment
+	 */
+	struct Header
+	{
+		std::uint32_t magic; //!< Magic number, see shm::magic
+		std::uint32_t version; //!< Version of the memory layout, see shm::version
+		std::uint64_t segmentSize; //!< Total size of the shared memory segment in bytes
+		std::uint64_t capacity; //!< Number of slots in the ring buffer
+		std::uint64_t slotSize; //!< Size of one slot in bytes
+		std::uint64_t dataOffset; //!< Offset of the first slot from the beginning of the segment in bytes
+		std::uint32_t numUnits; //!< Number of UnitLayout descriptors following the header
+		std::uint32_t padding; //!< Unused
+		std::atomic<std::uint64_t> numWritten; //!< Total number of completed time steps
+	};
+
+	/**
+	 * @brief Describes the data of a unit operation in a slot
+	 */
+	struct UnitLayout
+	{
+		std::uint32_t unitOpIdx; //!< Index of the unit operation
+		std::uint32_t numComponents; //!< Number of components
+		std::uint32_t numOutletPorts; //!< Number of outlet ports
+		std::uint32_t numAxialCells; //!< Number of axial cells
+		std::uint32_t numRadialCells; //!< Number of radial cells
+		std::uint32_t numBulkDofs; //!< Number of bulk volume elements in a slot, @c 0 if the bulk volume is not recorded
+		std::uint8_t bulkOrdering[8]; //!< Ordering of the bulk volume (values of cadet::StateOrdering)
+		std::uint32_t bulkOrderingLength; //!< Number of valid entries in @p bulkOrdering
+		std::uint32_t padding; //!< Unused
+		std::uint64_t outletOffset; //!< Offset of the outlet data from the beginning of a slot in bytes
+		std::uint64_t bulkOffset; //!< Offset of the bulk data from the beginning of a slot in bytes
+	};
+
+	/**
+	 * @brief Header at the beginning of each slot of the ring buffer
+	 */
+	struct SlotHeader
+	{
+		std::atomic<std::uint64_t> sequence; //!< One-based index of the time step stored in the slot, @c 0 while the slot is written
+		double time; //!< Simulation time of the time step
+	};
+
+	const std::size_t alignment = 64; //!< Alignment of the ring buffer and its slots in bytes
+
+	inline std::size_t alignedSize(std::size_t size) CADET_NOEXCEPT
+	{
+		return (size + alignment - 1) / alignment * alignment;
+	}
+
+} // namespace shm
+
+#ifdef CADET_SHARED_MEMORY_RECORDER_AVAILABLE
+
+/**
+ * @brief Publishes outlet and bulk concentrations in a POSIX shared memory ring buffer
+ * @details Live consumers on the same machine can map the shared memory segment and read the solution
+ *          while the simulation is running without file I/O. See the file documentation for the
+ *          memory layout. Only the solution is published, derivatives and sensitivities are ignored.
+ *
+ *          The segment is created (or resized) at the first time step of a simulation, since its
+ *          size depends on the structure of the unit operations. It is removed when the recorder is
+ *          destroyed unless keepSegment() is set. Consumers that map the segment keep access to
+ *          it until they unmap it.
+ */
+class SharedMemoryRecorder : public ISolutionRecorder
+{
+public:
+
+	/**
+	 * @brief Creates a recorder that publishes to the given shared memory segment
+	 * @param [in] name Name of the shared memory segment (e.g., "/cadet")
+	 * @param [in] capacity Number of time steps in the ring buffer
+	 */
+	SharedMemoryRecorder(const std::string& name, unsigned int capacity) : _name(name), _capacity(std::max(capacity, 1u)),
+		_storeBulk(false), _keepSegment(false), _fd(-1), _segment(nullptr), _segmentSize(0), _needsLayout(true), _inSolution(false),
+		_numWritten(0), _curSlot(nullptr), _slotSize(0), _dataOffset(0)
+	{
+		if (!_name.empty() && (_name[0] != '/'))
+			_name = "/" + _name;
+	}
+
+	virtual ~SharedMemoryRecorder() CADET_NOEXCEPT
+	{
+		unmap();
+		if (!_keepSegment)
+			shm_unlink(_name.c_str());
+	}
+
+	virtual void clear()
+	{
+		_numWritten = 0;
+		if (_segment)
+			header()->numWritten.store(0, std::memory_order_release);
+	}
+
+	virtual void prepare(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps)
+	{
+		_layouts.clear();
+		_needsLayout = true;
+	}
+
+	virtual void notifyIntegrationStart(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps)
+	{
+		_layouts.clear();
+		_needsLayout = true;
+	}
+
+	virtual void unitOperationStructure(UnitOpIdx idx, const IModel& model, const ISolutionExporter& exporter)
+	{
+		if (!_units.empty() && (std::find(_units.begin(), _units.end(), idx) == _units.end()))
+			return;
+
+		shm::UnitLayout layout;
+		std::memset(&layout, 0, sizeof(layout));
+		layout.unitOpIdx = idx;
+		layout.numComponents = exporter.numComponents();
+		layout.numOutletPorts = exporter.numOutletPorts();
+		layout.numAxialCells = exporter.numAxialCells();
+		layout.numRadialCells = exporter.numRadialCells();
+
+		unsigned int len = 0;
+		StateOrdering const* const order = exporter.concentrationOrdering(len);
+		layout.bulkOrderingLength = std::min(len, static_cast<unsigned int>(sizeof(layout.bulkOrdering)));
+		for (unsigned int i = 0; i < layout.bulkOrderingLength; ++i)
+			layout.bulkOrdering[i] = static_cast<std::uint8_t>(order[i]);
+
+		// Bulk volume consists of blocks of components, one for each cell
+		unsigned int numBlocks = 1;
+		for (unsigned int i = 0; i < len; ++i)
+		{
+			if (order[i] == StateOrdering::AxialCell)
+				numBlocks *= exporter.numAxialCells();
+			else if (order[i] == StateOrdering::RadialCell)
+				numBlocks *= exporter.numRadialCells();
+		}
+
+		if (_storeBulk && (numBlocks > 0) && (exporter.numBulkDofs() > 0))
+			layout.numBulkDofs = exporter.numBulkDofs();
+
+		// Remove layout reported in a previous call
+		_layouts.erase(std::remove_if(_layouts.begin(), _layouts.end(), [=](const UnitInfo& info) { return info.layout.unitOpIdx == idx; }), _layouts.end());
+		_layouts.push_back(UnitInfo{layout, (numBlocks > 0) ? exporter.numBulkDofs() / numBlocks : 0u, numBlocks});
+		_needsLayout = true;
+	}
+
+	virtual void beginTimestep(double t)
+	{
+		if (_needsLayout)
+			createSegment();
+
+		_curSlot = _segment + _dataOffset + (_numWritten % _capacity) * _slotSize;
+
+		// Invalidate slot before overwriting it
+		shm::SlotHeader* const slot = reinterpret_cast<shm::SlotHeader*>(_curSlot);
+		slot->sequence.store(0, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		slot->time = t;
+	}
+
+	virtual void beginUnitOperation(cadet::UnitOpIdx idx, const cadet::IModel& model, const cadet::ISolutionExporter& exporter)
+	{
+		if (!_inSolution || !_curSlot)
+			return;
+
+		for (const UnitInfo& info : _layouts)
+		{
+			if (info.layout.unitOpIdx != idx)
+				continue;
+
+			unsigned int stride = 0;
+			double* out = reinterpret_cast<double*>(_curSlot + info.layout.outletOffset);
+			for (unsigned int j = 0; j < info.layout.numOutletPorts; ++j)
+			{
+				double const* const outlet = exporter.outlet(j, stride);
+				for (unsigned int i = 0; i < info.layout.numComponents; ++i, ++out)
+					*out = outlet[i * stride];
+			}
+
+			if (info.layout.numBulkDofs > 0)
+			{
+				double const* const data = exporter.concentration();
+				const unsigned int blockStride = exporter.bulkMobilePhaseStride();
+				double* const bulk = reinterpret_cast<double*>(_curSlot + info.layout.bulkOffset);
+				for (unsigned int b = 0; b < info.numBlocks; ++b)
+					std::copy(data + b * blockStride, data + b * blockStride + info.blockSize, bulk + b * info.blockSize);
+			}
+
+			return;
+		}
+	}
+
+	virtual void endUnitOperation() { }
+
+	virtual void endTimestep()
+	{
+		if (!_curSlot)
+			return;
+
+		++_numWritten;
+
+		// Publish slot
+		reinterpret_cast<shm::SlotHeader*>(_curSlot)->sequence.store(_numWritten, std::memory_order_release);
+		header()->numWritten.store(_numWritten, std::memory_order_release);
+		_curSlot = nullptr;
+	}
+
+	virtual void beginSolution() { _inSolution = true; }
+	virtual void endSolution() { _inSolution = false; }
+	virtual void beginSolutionDerivative() { }
+	virtual void endSolutionDerivative() { }
+	virtual void beginSensitivity(const cadet::ParameterId& pId, unsigned int sensIdx) { }
+	virtual void endSensitivity(const cadet::ParameterId& pId, unsigned int sensIdx) { }
+	virtual void beginSensitivityDerivative(const cadet::ParameterId& pId, unsigned int sensIdx) { }
+	virtual void endSensitivityDerivative(const cadet::ParameterId& pId, unsigned int sensIdx) { }
+
+	/**
+	 * @brief Selects the unit operations that are published
+	 * @param [in] units Indices of the published unit operations, all unit operations are published if empty
+	 */
+	inline void units(const std::vector<UnitOpIdx>& units) { _units = units; }
+
+	inline bool storeBulk() const CADET_NOEXCEPT { return _storeBulk; }
+	inline void storeBulk(bool sb) CADET_NOEXCEPT { _storeBulk = sb; }
+
+	/**
+	 * @brief Determines whether the shared memory segment is kept after the recorder is destroyed
+	 * @param [in] keep @c true to keep the segment, @c false to remove it (default)
+	 */
+	inline void keepSegment(bool keep) CADET_NOEXCEPT { _keepSegment = keep; }
+
+	inline const std::string& name() const CADET_NOEXCEPT { return _name; }
+	inline unsigned int capacity() const CADET_NOEXCEPT { return _capacity; }
+	inline std::uint64_t numDataPoints() const CADET_NOEXCEPT { return _numWritten; }
+
+protected:
+
+	/**
+	 * @brief Layout and block structure of a published unit operation
+	 */
+	struct UnitInfo
+	{
+		shm::UnitLayout layout; //!< Layout in the shared memory segment
+		unsigned int blockSize; //!< Number of elements in a bulk volume block
+		unsigned int numBlocks; //!< Number of bulk volume blocks
+	};
+
+	std::string _name; //!< Name of the shared memory segment
+	unsigned int _capacity; //!< Number of slots in the ring buffer
+	bool _storeBulk; //!< Determines whether the bulk volume is published
+	bool _keepSegment; //!< Determines whether the segment is kept after destruction
+	std::vector<UnitOpIdx> _units; //!< Published unit operations, empty for all
+
+	int _fd; //!< File descriptor of the shared memory segment
+	char* _segment; //!< Mapped shared memory segment
+	std::size_t _segmentSize; //!< Size of the mapped segment in bytes
+	std::vector<UnitInfo> _layouts; //!< Layouts of the published unit operations
+	bool _needsLayout; //!< Determines whether the segment has to be (re)created before the next time step
+	bool _inSolution; //!< Determines whether the solution (and not a derivative or sensitivity) is reported
+	std::uint64_t _numWritten; //!< Number of completed time steps
+	char* _curSlot; //!< Slot of the current time step
+	std::size_t _slotSize; //!< Size of a slot in bytes
+	std::size_t _dataOffset; //!< Offset of the ring buffer in bytes
+
+	inline shm::Header* header() const CADET_NOEXCEPT { return reinterpret_cast<shm::Header*>(_segment); }
+
+	inline void createSegment()
+	{
+		// Assign offsets of unit operation data in the slots
+		std::size_t offset = sizeof(shm::SlotHeader);
+		for (UnitInfo& info : _layouts)
+		{
+			info.layout.outletOffset = offset;
+			offset += sizeof(double) * info.layout.numOutletPorts * info.layout.numComponents;
+			info.layout.bulkOffset = offset;
+			offset += sizeof(double) * info.layout.numBulkDofs;
+		}
+
+		_slotSize = shm::alignedSize(offset);
+		_dataOffset = shm::alignedSize(sizeof(shm::Header) + _layouts.size() * sizeof(shm::UnitLayout));
+		const std::size_t size = _dataOffset + _capacity * _slotSize;
+
+		if (size != _segmentSize)
+		{
+			unmap();
+
+			_fd = shm_open(_name.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR);
+			if (_fd < 0)
+				throw io::IOException("Could not open shared memory segment " + _name + ": " + std::strerror(errno));
+
+			if (ftruncate(_fd, size) != 0)
+			{
+				unmap();
+				throw io::IOException("Could not resize shared memory segment " + _name + ": " + std::strerror(errno));
+			}
+
+			void* const mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+			if (mem == MAP_FAILED)
+			{
+				unmap();
+				throw io::IOException("Could not map shared memory segment " + _name + ": " + std::strerror(errno));
+			}
+
+			_segment = static_cast<char*>(mem);
+			_segmentSize = size;
+		}
+
+		// Invalidate header while the layout is written
+		shm::Header* const h = header();
+		h->magic = 0;
+		std::atomic_thread_fence(std::memory_order_release);
+
+		h->version = shm::version;
+		h->segmentSize = _segmentSize;
+		h->capacity = _capacity;
+		h->slotSize = _slotSize;
+		h->dataOffset = _dataOffset;
+		h->numUnits = _layouts.size();
+		h->padding = 0;
+		new(&h->numWritten) std::atomic<std::uint64_t>(0);
+
+		shm::UnitLayout* const layouts = reinterpret_cast<shm::UnitLayout*>(_segment + sizeof(shm::Header));
+		for (std::size_t i = 0; i < _layouts.size(); ++i)
+			layouts[i] = _layouts[i].layout;
+
+		for (unsigned int i = 0; i < _capacity; ++i)
+		{
+			shm::SlotHeader* const slot = reinterpret_cast<shm::SlotHeader*>(_segment + _dataOffset + i * _slotSize);
+			new(&slot->sequence) std::atomic<std::uint64_t>(0);
+			slot->time = 0.0;
+		}
+
+		std::atomic_thread_fence(std::memory_order_release);
+		h->magic = shm::magic;
+
+		_numWritten = 0;
+		_needsLayout = false;
+	}
+
+	inline void unmap() CADET_NOEXCEPT
+	{
+		if (_segment)
+			munmap(_segment, _segmentSize);
+		if (_fd >= 0)
+			close(_fd);
+
+		_segment = nullptr;
+		_segmentSize = 0;
+		_fd = -1;
+		_curSlot = nullptr;
+	}
+};
+
+#endif
+
+} // namespace cadet
+
+#endif  // LIBCADET_SHAREDMEMORYRECORDER_HPP_
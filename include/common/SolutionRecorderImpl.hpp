@@ -19,11 +19,14 @@
 #define LIBCADET_SOLUTIONRECORDER_IMPL_HPP_
 
 #include <vector>
+#include <string>
 #include <sstream>
+#include <iomanip>
 #include <algorithm>
 #include <numeric>
 
 #include "cadet/SolutionRecorder.hpp"
+#include "cadet/Exceptions.hpp"
 
 namespace cadet
 {
@@ -35,7 +38,10 @@ namespace detail
 
 /**
  * @brief Stores pieces of the solution of one single unit operation in internal buffers
- * @details The pieces of stored solutions are selectable at runtime.
+ * @details The pieces of stored solutions are selectable at runtime. The amount of stored data
+ *          can be reduced further by recording only some axial cells, particle shells, and
+ *          components (region of interest), by skipping time points (decimation), and by only
+ *          storing averages of the solid phase.
  * @todo Use better storage than std::vector (control growth, maybe chunked storage -> needs chunked writes)
  */
 class InternalStorageUnitOpRecorder : public ISolutionRecorder
@@ -51,15 +57,18 @@ public:
 		bool storeOutlet;
 		bool storeInlet;
 		bool storeVolume;
+		bool storeSolidParticleAverage;
+		bool storeSolidColumnAverage;
 	};
 
 	InternalStorageUnitOpRecorder() : InternalStorageUnitOpRecorder(UnitOpIndep) { }
 
-	InternalStorageUnitOpRecorder(UnitOpIdx idx) : _cfgSolution({false, false, false, true, false, false}),
-		_cfgSolutionDot({false, false, false, false, false, false}), _cfgSensitivity({false, false, false, true, false, false}),
-		_cfgSensitivityDot({false, false, false, true, false, false}), _storeTime(false), _storeCoordinates(false), _splitComponents(true), _splitPorts(true),
+	InternalStorageUnitOpRecorder(UnitOpIdx idx) : _cfgSolution({false, false, false, true, false, false, false, false, false}),
+		_cfgSolutionDot({false, false, false, false, false, false, false, false, false}), _cfgSensitivity({false, false, false, true, false, false, false, false, false}),
+		_cfgSensitivityDot({false, false, false, true, false, false, false, false, false}), _storeTime(false), _storeCoordinates(false), _splitComponents(true), _splitPorts(true),
 		_singleAsMultiPortUnitOps(false), _curCfg(nullptr), _nComp(0), _nVolumeDof(0), _numTimesteps(0), _numSens(0), _unitOp(idx), _needsReAlloc(false),
-		_axialCoords(0), _radialCoords(0), _particleCoords(0)
+		_axialCoords(0), _radialCoords(0), _particleCoords(0), _nRecComp(0), _recordEvery(1), _recordMinDt(0.0), _numReceivedTimesteps(0),
+		_numExpectedTimesteps(0), _lastRecordedTime(0.0), _skipTimestep(false)
 	{
 	}
 
@@ -71,6 +80,8 @@ public:
 	{
 		// Clear solution storage
 		_time.clear();
+		_numReceivedTimesteps = 0;
+		_skipTimestep = false;
 		clear(_data);
 		clear(_dataDot);
 
@@ -85,6 +96,7 @@ public:
 	virtual void prepare(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps)
 	{
 		_numTimesteps = numTimesteps;
+		_numExpectedTimesteps = numTimesteps;
 		_numSens = numSens;
 
 		// Allocate sensitivity storage
@@ -102,6 +114,7 @@ public:
 		clear();
 
 		_numTimesteps = numTimesteps;
+		_numExpectedTimesteps = numTimesteps;
 		
 		if (numSens != _numSens)
 		{
@@ -134,6 +147,18 @@ public:
 			_nBoundStates[i] = exporter.numBoundStates(i);
 		}
 
+		// Validate region of interest
+		validateSelection(_axialCells, exporter.numAxialCells(), "axial cell");
+		validateSelection(_components, exporter.numComponents(), "component");
+		for (unsigned int i = 0; i < numParTypes; ++i)
+		{
+			if (_nParShells[i] > 0)
+				validateSelection(_particleShells, _nParShells[i], "particle shell");
+		}
+
+		_nRecComp = numSelected(_components, _nComp);
+		const unsigned int nRecAxial = numSelected(_axialCells, exporter.numAxialCells());
+
 		// Query structure
 		unsigned int len = 0;
 		StateOrdering const* order = exporter.concentrationOrdering(len);
@@ -146,10 +171,10 @@ public:
 			switch (order[i])
 			{
 				case StateOrdering::Component:
-					_bulkLayout.push_back(exporter.numComponents());
+					_bulkLayout.push_back(_nRecComp);
 					break;
 				case StateOrdering::AxialCell:
-					_bulkLayout.push_back(exporter.numAxialCells());
+					_bulkLayout.push_back(nRecAxial);
 					_bulkCount *= exporter.numAxialCells();
 					break;
 				case StateOrdering::RadialCell:
@@ -162,6 +187,9 @@ public:
 			}
 		}
 
+		if (_bulkCount > 0)
+			selectBlocks(order, len, exporter, 0, exporter.numBulkDofs() / _bulkCount, true, _bulkSel);
+
 		order = exporter.mobilePhaseOrdering(len);
 		_particleLayout.clear();
 		_particleLayout.resize(numParTypes, std::vector<std::size_t>(len + 1, 0)); // First slot is time
@@ -174,7 +202,7 @@ public:
 				case StateOrdering::Component:
 				{
 					for (unsigned int j = 0; j < numParTypes; ++j)
-						_particleLayout[j][idxLayout] = exporter.numComponents();
+						_particleLayout[j][idxLayout] = _nRecComp;
 
 					++idxLayout;
 					break;
@@ -183,7 +211,7 @@ public:
 				{
 					for (unsigned int j = 0; j < numParTypes; ++j)
 					{
-						_particleLayout[j][idxLayout] = exporter.numAxialCells();
+						_particleLayout[j][idxLayout] = nRecAxial;
 						_particleCount[j] *= exporter.numAxialCells();
 					}
 
@@ -207,7 +235,7 @@ public:
 				{
 					for (unsigned int j = 0; j < numParTypes; ++j)
 					{
-						_particleLayout[j][idxLayout] = _nParShells[j];
+						_particleLayout[j][idxLayout] = numSelected(_particleShells, _nParShells[j]);
 						_particleCount[j] *= _nParShells[j];
 					}
 
@@ -219,14 +247,22 @@ public:
 			}
 		}
 
+		_particleSel.resize(numParTypes);
 		for (unsigned int j = 0; j < numParTypes; ++j)
+		{
 			_particleLayout[j].resize(idxLayout);
+			if (_particleCount[j] > 0)
+				selectBlocks(order, len, exporter, _nParShells[j], exporter.numParticleMobilePhaseDofs(j) / _particleCount[j], true, _particleSel[j]);
+		}
 
 		order = exporter.solidPhaseOrdering(len);
 		_solidLayout.clear();
 		_solidLayout.resize(numParTypes, std::vector<std::size_t>(len + 1, 0)); // First slot is time
+		_solidParAvgLayout.clear();
+		_solidParAvgLayout.resize(numParTypes, std::vector<std::size_t>(len + 1, 0)); // First slot is time
 		_solidCount = std::vector<unsigned int>(numParTypes, 1u);
 		idxLayout = 1;
+		unsigned int idxAvgLayout = 1;
 		for (unsigned int i = 0; i < len; ++i)
 		{
 			switch (order[i])
@@ -237,11 +273,13 @@ public:
 				{
 					for (unsigned int j = 0; j < numParTypes; ++j)
 					{
-						_solidLayout[j][idxLayout] = exporter.numAxialCells();
+						_solidLayout[j][idxLayout] = nRecAxial;
+						_solidParAvgLayout[j][idxAvgLayout] = nRecAxial;
 						_solidCount[j] *= exporter.numAxialCells();
 					}
 
 					++idxLayout;
+					++idxAvgLayout;
 					break;
 				}
 				case StateOrdering::RadialCell:
@@ -249,10 +287,12 @@ public:
 					for (unsigned int j = 0; j < numParTypes; ++j)
 					{
 						_solidLayout[j][idxLayout] = exporter.numRadialCells();
+						_solidParAvgLayout[j][idxAvgLayout] = exporter.numRadialCells();
 						_solidCount[j] *= exporter.numRadialCells();
 					}
 
 					++idxLayout;
+					++idxAvgLayout;
 					break;
 				}
 				case StateOrdering::ParticleType:
@@ -261,7 +301,7 @@ public:
 				{
 					for (unsigned int j = 0; j < numParTypes; ++j)
 					{
-						_solidLayout[j][idxLayout] = _nParShells[j];
+						_solidLayout[j][idxLayout] = numSelected(_particleShells, _nParShells[j]);
 						_solidCount[j] *= _nParShells[j];
 					}
 
@@ -271,16 +311,26 @@ public:
 				case StateOrdering::BoundState:
 				{
 					for (unsigned int j = 0; j < numParTypes; ++j)
+					{
 						_solidLayout[j][idxLayout] = _nBoundStates[j];
+						_solidParAvgLayout[j][idxAvgLayout] = _nBoundStates[j];
+					}
 
 					++idxLayout;
+					++idxAvgLayout;
 					break;
 				}
 			}
 		}
 
+		_solidSel.resize(numParTypes);
 		for (unsigned int j = 0; j < numParTypes; ++j)
+		{
 			_solidLayout[j].resize(idxLayout);
+			_solidParAvgLayout[j].resize(idxAvgLayout);
+			if (_solidCount[j] > 0)
+				selectBlocks(order, len, exporter, _nParShells[j], exporter.numSolidPhaseDofs(j) / _solidCount[j], false, _solidSel[j]);
+		}
 
 		order = exporter.fluxOrdering(len);
 		_fluxLayout.clear();
@@ -308,23 +358,35 @@ public:
 			}
 		}
 
-		// Obtain coordinates
+		// Obtain coordinates of recorded cells and shells
+		_axialCoords.clear();
+		_radialCoords.clear();
+		_particleCoords.clear();
+
+		std::vector<double> coords;
 		if (_storeCoordinates)
 		{
-			_axialCoords.resize(exporter.numAxialCells());
-			_radialCoords.resize(exporter.numRadialCells());
-			const unsigned int numShells = std::accumulate(_nParShells.begin(), _nParShells.end(), 0u);
-			_particleCoords.resize(numShells);
+			coords.resize(exporter.numAxialCells());
+			exporter.axialCoordinates(coords.data());
+			appendSelected(_axialCoords, coords.data(), coords.size(), _axialCells);
 
-			exporter.axialCoordinates(_axialCoords.data());
+			_radialCoords.resize(exporter.numRadialCells());
 			exporter.radialCoordinates(_radialCoords.data());
+		}
 
-			unsigned int offset = 0;
-			for (unsigned int i = 0; i < numParTypes; ++i)
-			{
-				exporter.particleCoordinates(i, _particleCoords.data() + offset);
-				offset += _nParShells[i];
-			}
+		// Particle coordinates are also required for weighting averages by shell volume
+		for (unsigned int i = 0; i < numParTypes; ++i)
+		{
+			if (_nParShells[i] == 0)
+				continue;
+
+			coords.resize(_nParShells[i]);
+			exporter.particleCoordinates(i, coords.data());
+
+			if (_storeCoordinates)
+				appendSelected(_particleCoords, coords.data(), coords.size(), _particleShells);
+			if (_solidCount[i] > 0)
+				weightByShellVolume(_solidSel[i], shellVolumes(coords.data(), coords.size()));
 		}
 
 		// Validate config
@@ -362,7 +424,7 @@ public:
 			endSolution();
 		}
 
-		if (_storeTime)
+		if (storesTime())
 		{
 			if (_numTimesteps == 0)
 				_time.reserve(detail::numDefaultRecorderTimesteps);
@@ -376,15 +438,24 @@ public:
 
 	virtual void beginTimestep(double t)
 	{
+		// Decimate time points, but always keep the final one
+		++_numReceivedTimesteps;
+		const bool lastTimestep = (_numReceivedTimesteps == _numExpectedTimesteps);
+		_skipTimestep = !lastTimestep && (((_numReceivedTimesteps - 1) % _recordEvery != 0) || ((_numTimesteps > 0) && (t - _lastRecordedTime < _recordMinDt)));
+
+		if (_skipTimestep)
+			return;
+
 		++_numTimesteps;
-		if (_storeTime)
+		_lastRecordedTime = t;
+		if (storesTime())
 			_time.push_back(t);
 	}
 
 	virtual void beginUnitOperation(cadet::UnitOpIdx idx, const cadet::IModel& model, const cadet::ISolutionExporter& exporter)
 	{
 		// Only record one unit operation
-		if ((idx != _unitOp) || !_curCfg)
+		if ((idx != _unitOp) || !_curCfg || _skipTimestep)
 			return;
 
 		unsigned int stride = 0;
@@ -395,8 +466,8 @@ public:
 			for (unsigned int j = 0; j < _nOutletPorts; ++j)
 			{
 				double const* outlet = exporter.outlet(j, stride);
-				for (unsigned int i = 0; i < _nComp; ++i)
-					v.push_back(outlet[i * stride]);
+				for (unsigned int i = 0; i < _nRecComp; ++i)
+					v.push_back(outlet[componentIndex(i) * stride]);
 			}
 		}
 
@@ -406,50 +477,41 @@ public:
 			for (unsigned int j = 0; j < _nInletPorts; ++j)
 			{
 				double const* inlet = exporter.inlet(j, stride);
-				for (unsigned int i = 0; i < _nComp; ++i)
-					v.push_back(inlet[i * stride]);
+				for (unsigned int i = 0; i < _nRecComp; ++i)
+					v.push_back(inlet[componentIndex(i) * stride]);
 			}
 		}
 
 		if (_curCfg->storeBulk)
+			recordBlocks(_curStorage->bulk, exporter.concentration(), exporter.bulkMobilePhaseStride(), _bulkSel);
+
+		if (_curCfg->storeParticle)
 		{
-			std::vector<double>& v = _curStorage->bulk;
-			double const* data = exporter.concentration();
-			stride = exporter.bulkMobilePhaseStride();
-			const unsigned int blockSize = exporter.numBulkDofs() / _bulkCount;
-			for (unsigned int i = 0; i < _bulkCount; ++i, data += stride)
-			{
-				v.insert(v.end(), data, data + blockSize);
-			}
+			for (unsigned int parType = 0; parType < _nParShells.size(); ++parType)
+				recordBlocks(_curStorage->particle[parType], exporter.particleMobilePhase(parType), exporter.particleMobilePhaseStride(parType), _particleSel[parType]);
 		}
 
-		if (_curCfg->storeParticle)
+		if (_curCfg->storeSolid)
+		{
+			for (unsigned int parType = 0; parType < _nParShells.size(); ++parType)
+				recordBlocks(_curStorage->solid[parType], exporter.solidPhase(parType), exporter.solidPhaseStride(parType), _solidSel[parType]);
+		}
+
+		if (_curCfg->storeSolidParticleAverage)
 		{
 			for (unsigned int parType = 0; parType < _nParShells.size(); ++parType)
 			{
-				std::vector<double>& cp = _curStorage->particle[parType];
-				double const* data = exporter.particleMobilePhase(parType);
-				stride = exporter.particleMobilePhaseStride(parType);
-				const unsigned int blockSize = exporter.numParticleMobilePhaseDofs(parType) / _particleCount[parType];
-				for (unsigned int i = 0; i < _particleCount[parType]; ++i, data += stride)
-				{
-					cp.insert(cp.end(), data, data + blockSize);
-				}
+				const Selection& sel = _solidSel[parType];
+				recordAverage(_curStorage->solidParticleAvg[parType], exporter.solidPhase(parType), exporter.solidPhaseStride(parType), sel, sel.avgTarget.data(), sel.numAvg, sel.particleWeights.data());
 			}
 		}
 
-		if (_curCfg->storeSolid)
+		if (_curCfg->storeSolidColumnAverage)
 		{
 			for (unsigned int parType = 0; parType < _nParShells.size(); ++parType)
 			{
-				std::vector<double>& cs = _curStorage->solid[parType];
-				double const* data = exporter.solidPhase(parType);
-				stride = exporter.solidPhaseStride(parType);
-				const unsigned int blockSize = exporter.numSolidPhaseDofs(parType) / _solidCount[parType];
-				for (unsigned int i = 0; i < _solidCount[parType]; ++i, data += stride)
-				{
-					cs.insert(cs.end(), data, data + blockSize);
-				}
+				const Selection& sel = _solidSel[parType];
+				recordAverage(_curStorage->solidColumnAvg[parType], exporter.solidPhase(parType), exporter.solidPhaseStride(parType), sel, nullptr, 1, sel.columnWeights.data());
 			}
 		}
 
@@ -533,9 +595,10 @@ public:
 				oss.str("");
 				oss << "PARTICLE_COORDINATES_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << pt;
 
-				writer.template vector<double>(oss.str(), _nParShells[pt], _particleCoords.data() + offset);
+				const unsigned int nShells = numSelected(_particleShells, _nParShells[pt]);
+				writer.template vector<double>(oss.str(), nShells, _particleCoords.data() + offset);
 
-				offset += _nParShells[pt];
+				offset += nShells;
 			}
 		}
 	}
@@ -545,7 +608,7 @@ public:
 	{
 		std::ostringstream oss;
 
-		if (_storeTime)
+		if (storesTime())
 			writer.template vector<double>("SOLUTION_TIMES", _time.size(), _time.data());
 
 		beginSolution();
@@ -628,12 +691,58 @@ public:
 	inline UnitOpIdx unitOperation() const CADET_NOEXCEPT { return _unitOp; }
 	inline void unitOperation(UnitOpIdx idx) CADET_NOEXCEPT { _unitOp = idx; }
 
+	/**
+	 * @brief Restricts recording of bulk, particle, and solid phase to some axial cells
+	 * @param [in] idx Indices of the recorded axial cells, empty for all cells
+	 */
+	inline void recordAxialCells(const std::vector<unsigned int>& idx) { _axialCells = sortedUnique(idx); }
+	inline const std::vector<unsigned int>& recordAxialCells() const CADET_NOEXCEPT { return _axialCells; }
+
+	/**
+	 * @brief Restricts recording of particle and solid phase to some particle shells
+	 * @details The same shells are recorded for all particle types.
+	 * @param [in] idx Indices of the recorded particle shells, empty for all shells
+	 */
+	inline void recordParticleShells(const std::vector<unsigned int>& idx) { _particleShells = sortedUnique(idx); }
+	inline const std::vector<unsigned int>& recordParticleShells() const CADET_NOEXCEPT { return _particleShells; }
+
+	/**
+	 * @brief Restricts recording of inlet, outlet, bulk, and particle mobile phase to some components
+	 * @details The solid phase is not affected since bound states are not assigned to components.
+	 * @param [in] idx Indices of the recorded components, empty for all components
+	 */
+	inline void recordComponents(const std::vector<unsigned int>& idx) { _components = sortedUnique(idx); }
+	inline const std::vector<unsigned int>& recordComponents() const CADET_NOEXCEPT { return _components; }
+
+	/**
+	 * @brief Sets the decimation of recorded time points
+	 * @details A time point is only recorded if it is the @p every -th time point received and
+	 *          its distance to the last recorded time point is at least @p minDt. The first and
+	 *          the last time point are always recorded. The last time point is identified by the
+	 *          number of time points passed to prepare() or notifyIntegrationStart() and, hence,
+	 *          cannot be detected if this number is @c 0 (i.e., unknown). If time points are skipped, the recorded time points are
+	 *          stored separately for this unit operation.
+	 * @param [in] every Records every @p every -th time point
+	 * @param [in] minDt Minimum time difference between recorded time points
+	 */
+	inline void decimation(unsigned int every, double minDt) CADET_NOEXCEPT
+	{
+		_recordEvery = std::max(every, 1u);
+		_recordMinDt = std::max(minDt, 0.0);
+	}
+	inline unsigned int recordEvery() const CADET_NOEXCEPT { return _recordEvery; }
+	inline double recordMinDt() const CADET_NOEXCEPT { return _recordMinDt; }
+	inline bool decimates() const CADET_NOEXCEPT { return (_recordEvery > 1) || (_recordMinDt > 0.0); }
+
 	inline unsigned int numDataPoints() const CADET_NOEXCEPT { return _numTimesteps; }
 	inline unsigned int numComponents() const CADET_NOEXCEPT { return _nComp; }
+	inline unsigned int numRecordedComponents() const CADET_NOEXCEPT { return _nRecComp; }
 	inline unsigned int numInletPorts() const CADET_NOEXCEPT { return _nInletPorts; }
 	inline unsigned int numOutletPorts() const CADET_NOEXCEPT { return _nOutletPorts; }
 
 	inline double const* time() const CADET_NOEXCEPT { return _time.data(); }
+	inline const std::vector<double>& axialCoordinates() const CADET_NOEXCEPT { return _axialCoords; }
+	inline const std::vector<double>& particleCoordinates() const CADET_NOEXCEPT { return _particleCoords; }
 	inline double const* inlet() const CADET_NOEXCEPT { return _data.inlet.data(); }
 	inline double const* outlet() const CADET_NOEXCEPT { return _data.outlet.data(); }
 	inline double const* bulk() const CADET_NOEXCEPT { return _data.bulk.data(); }
@@ -641,6 +750,8 @@ public:
 	inline double const* solid(unsigned int parType = 0) const CADET_NOEXCEPT { return _data.solid[parType].data(); }
 	inline double const* flux() const CADET_NOEXCEPT { return _data.flux.data(); }
 	inline double const* volume() const CADET_NOEXCEPT { return _data.volume.data(); }
+	inline double const* solidParticleAverage(unsigned int parType = 0) const CADET_NOEXCEPT { return _data.solidParticleAvg[parType].data(); }
+	inline double const* solidColumnAverage(unsigned int parType = 0) const CADET_NOEXCEPT { return _data.solidColumnAvg[parType].data(); }
 	inline double const* inletDot() const CADET_NOEXCEPT { return _dataDot.inlet.data(); }
 	inline double const* outletDot() const CADET_NOEXCEPT { return _dataDot.outlet.data(); }
 	inline double const* bulkDot() const CADET_NOEXCEPT { return _dataDot.bulk.data(); }
@@ -673,6 +784,27 @@ protected:
 		std::vector<std::vector<double>> solid;
 		std::vector<double> flux;
 		std::vector<double> volume;
+		std::vector<std::vector<double>> solidParticleAvg;
+		std::vector<std::vector<double>> solidColumnAvg;
+	};
+
+	/**
+	 * @brief Recorded part of a field (e.g., bulk or solid phase)
+	 * @details A field consists of blocks of consecutive entries (components or bound states), which are
+	 *          enumerated by the remaining dimensions (axial and radial cells, particle shells).
+	 */
+	struct Selection
+	{
+		std::vector<unsigned int> blocks; //!< Indices of the recorded blocks
+		std::vector<unsigned int> entries; //!< Indices of the recorded entries in a block, empty for all entries
+		std::vector<unsigned int> avgTarget; //!< Index of the particle average each recorded block contributes to
+		std::vector<unsigned int> shells; //!< Particle shell index of each recorded block
+		std::vector<double> particleWeights; //!< Weight of each recorded block in its particle average
+		std::vector<double> columnWeights; //!< Weight of each recorded block in the column average
+		unsigned int blockSize; //!< Number of entries in a block
+		unsigned int numAvg; //!< Number of particle averages (i.e., recorded blocks without particle shell dimension)
+
+		inline unsigned int numEntries() const CADET_NOEXCEPT { return entries.empty() ? blockSize : entries.size(); }
 	};
 
 	inline void beginSensitivity(unsigned int sensIdx)
@@ -696,6 +828,267 @@ protected:
 		cfg.storeSolid = exporter.hasSolidPhase() && cfg.storeSolid;
 		cfg.storeFlux = exporter.hasParticleFlux() && cfg.storeFlux;
 		cfg.storeVolume = exporter.hasVolume() && cfg.storeVolume;
+		cfg.storeSolidParticleAverage = exporter.hasSolidPhase() && cfg.storeSolidParticleAverage;
+		cfg.storeSolidColumnAverage = exporter.hasSolidPhase() && cfg.storeSolidColumnAverage;
+	}
+
+	inline bool storesTime() const CADET_NOEXCEPT { return _storeTime || decimates(); }
+
+	inline unsigned int componentIndex(unsigned int i) const CADET_NOEXCEPT { return _components.empty() ? i : _components[i]; }
+
+	static inline unsigned int numSelected(const std::vector<unsigned int>& sel, unsigned int size) CADET_NOEXCEPT
+	{
+		return sel.empty() ? size : sel.size();
+	}
+
+	static inline std::vector<unsigned int> sortedUnique(std::vector<unsigned int> idx)
+	{
+		std::sort(idx.begin(), idx.end());
+		idx.erase(std::unique(idx.begin(), idx.end()), idx.end());
+		return idx;
+	}
+
+	static inline void validateSelection(const std::vector<unsigned int>& sel, unsigned int size, const char* name)
+	{
+		if (!sel.empty() && (sel.back() >= size))
+			throw InvalidParameterException("Recorded " + std::string(name) + " index " + std::to_string(sel.back()) + " exceeds number of elements (" + std::to_string(size) + ")");
+	}
+
+	/**
+	 * @brief Determines the recorded blocks of a field
+	 * @param [in] order Ordering of the field
+	 * @param [in] len Length of the ordering
+	 * @param [in] exporter Solution exporter
+	 * @param [in] nShells Number of particle shells of the particle type
+	 * @param [in] blockSize Number of entries in a block
+	 * @param [in] selectComponents Determines whether the entries of a block are components
+	 * @param [out] sel Selection
+	 */
+	inline void selectBlocks(StateOrdering const* order, unsigned int len, const ISolutionExporter& exporter, unsigned int nShells,
+		unsigned int blockSize, bool selectComponents, Selection& sel) const
+	{
+		// Collect dimensions that enumerate the blocks (slowest first)
+		std::vector<unsigned int> dimSize;
+		std::vector<std::vector<unsigned int> const*> dimSel;
+		std::vector<bool> dimIsShell;
+		for (unsigned int i = 0; i < len; ++i)
+		{
+			switch (order[i])
+			{
+				case StateOrdering::AxialCell:
+					dimSize.push_back(exporter.numAxialCells());
+					dimSel.push_back(&_axialCells);
+					dimIsShell.push_back(false);
+					break;
+				case StateOrdering::RadialCell:
+					dimSize.push_back(exporter.numRadialCells());
+					dimSel.push_back(nullptr);
+					dimIsShell.push_back(false);
+					break;
+				case StateOrdering::ParticleShell:
+					dimSize.push_back(nShells);
+					dimSel.push_back(&_particleShells);
+					dimIsShell.push_back(true);
+					break;
+				case StateOrdering::Component:
+				case StateOrdering::ParticleType:
+				case StateOrdering::BoundState:
+					break;
+			}
+		}
+
+		sel.blockSize = blockSize;
+		sel.entries = selectComponents ? _components : std::vector<unsigned int>(0);
+		sel.blocks.clear();
+		sel.avgTarget.clear();
+		sel.shells.clear();
+		sel.numAvg = 1;
+
+		unsigned int nBlocks = 1;
+		for (unsigned int d = 0; d < dimSize.size(); ++d)
+		{
+			nBlocks *= dimSize[d];
+			if (!dimIsShell[d])
+				sel.numAvg *= dimSel[d] ? numSelected(*dimSel[d], dimSize[d]) : dimSize[d];
+		}
+
+		for (unsigned int b = 0; b < nBlocks; ++b)
+		{
+			// Decompose block index into indices of the dimensions
+			unsigned int rem = b;
+			unsigned int target = 0;
+			unsigned int targetStride = 1;
+			unsigned int shell = 0;
+			bool recorded = true;
+			for (unsigned int d = dimSize.size(); d-- > 0; )
+			{
+				const unsigned int idx = rem % dimSize[d];
+				rem /= dimSize[d];
+
+				unsigned int pos = idx;
+				unsigned int nSel = dimSize[d];
+				if (dimSel[d] && !dimSel[d]->empty())
+				{
+					const std::vector<unsigned int>::const_iterator it = std::lower_bound(dimSel[d]->begin(), dimSel[d]->end(), idx);
+					if ((it == dimSel[d]->end()) || (*it != idx))
+					{
+						recorded = false;
+						break;
+					}
+					pos = it - dimSel[d]->begin();
+					nSel = dimSel[d]->size();
+				}
+
+				if (dimIsShell[d])
+					shell = idx;
+				else
+				{
+					target += pos * targetStride;
+					targetStride *= nSel;
+				}
+			}
+
+			if (recorded)
+			{
+				sel.blocks.push_back(b);
+				sel.avgTarget.push_back(target);
+				sel.shells.push_back(shell);
+			}
+		}
+
+		// Weight blocks equally until shell volumes are known
+		sel.particleWeights.assign(sel.blocks.size(), 1.0);
+		sel.columnWeights.assign(sel.blocks.size(), 1.0);
+		normalizeWeights(sel);
+	}
+
+	/**
+	 * @brief Computes the volumes of particle shells from their center coordinates
+	 * @details Shell boundaries are placed halfway between adjacent centers and the outermost and innermost
+	 *          boundaries are mirrored at the respective center. This recovers the boundaries of equidistant
+	 *          discretizations exactly. Particles are assumed to be spherical.
+	 * @param [in] coords Center coordinates of the shells (in ascending or descending order)
+	 * @param [in] nShells Number of shells
+	 * @return Volume of each shell (up to a common factor)
+	 */
+	static inline std::vector<double> shellVolumes(double const* coords, unsigned int nShells)
+	{
+		std::vector<double> vol(nShells, 1.0);
+		if (nShells <= 1)
+			return vol;
+
+		for (unsigned int i = 0; i < nShells; ++i)
+		{
+			const double lower = (i > 0) ? 0.5 * (coords[i - 1] + coords[i]) : 1.5 * coords[0] - 0.5 * coords[1];
+			const double upper = (i + 1 < nShells) ? 0.5 * (coords[i] + coords[i + 1]) : 1.5 * coords[i] - 0.5 * coords[i - 1];
+			const double rIn = std::max(std::min(lower, upper), 0.0);
+			const double rOut = std::max(std::max(lower, upper), 0.0);
+			vol[i] = rOut * rOut * rOut - rIn * rIn * rIn;
+		}
+		return vol;
+	}
+
+	/**
+	 * @brief Weights the recorded blocks of a selection by the volume of their particle shell
+	 * @param [in,out] sel Selection
+	 * @param [in] vol Volume of each particle shell
+	 */
+	static inline void weightByShellVolume(Selection& sel, const std::vector<double>& vol)
+	{
+		for (unsigned int i = 0; i < sel.blocks.size(); ++i)
+		{
+			sel.particleWeights[i] = vol[sel.shells[i]];
+			sel.columnWeights[i] = vol[sel.shells[i]];
+		}
+		normalizeWeights(sel);
+	}
+
+	/**
+	 * @brief Normalizes the weights of a selection such that they sum up to one for each average
+	 * @param [in,out] sel Selection
+	 */
+	static inline void normalizeWeights(Selection& sel)
+	{
+		std::vector<double> parTotal(sel.numAvg, 0.0);
+		double colTotal = 0.0;
+		for (unsigned int i = 0; i < sel.blocks.size(); ++i)
+		{
+			parTotal[sel.avgTarget[i]] += sel.particleWeights[i];
+			colTotal += sel.columnWeights[i];
+		}
+
+		for (unsigned int i = 0; i < sel.blocks.size(); ++i)
+		{
+			sel.particleWeights[i] /= parTotal[sel.avgTarget[i]];
+			sel.columnWeights[i] /= colTotal;
+		}
+	}
+
+	/**
+	 * @brief Appends the selected elements of a vector to another vector
+	 * @param [in,out] dest Destination
+	 * @param [in] src Source elements
+	 * @param [in] n Number of source elements
+	 * @param [in] sel Indices of the selected elements, empty for all elements
+	 */
+	static inline void appendSelected(std::vector<double>& dest, double const* src, unsigned int n, const std::vector<unsigned int>& sel)
+	{
+		if (sel.empty())
+			dest.insert(dest.end(), src, src + n);
+		else
+		{
+			for (unsigned int i : sel)
+				dest.push_back(src[i]);
+		}
+	}
+
+	/**
+	 * @brief Appends the selected part of a field to the given storage
+	 * @param [in,out] v Storage
+	 * @param [in] data Field data
+	 * @param [in] stride Distance between two blocks in @p data
+	 * @param [in] sel Selection
+	 */
+	static inline void recordBlocks(std::vector<double>& v, double const* data, unsigned int stride, const Selection& sel)
+	{
+		for (unsigned int b : sel.blocks)
+		{
+			double const* const block = data + b * stride;
+			if (sel.entries.empty())
+				v.insert(v.end(), block, block + sel.blockSize);
+			else
+			{
+				for (unsigned int e : sel.entries)
+					v.push_back(block[e]);
+			}
+		}
+	}
+
+	/**
+	 * @brief Appends averages of the selected blocks of a field to the given storage
+	 * @details Each block contributes to the average given by @p target with the given weight.
+	 * @param [in,out] v Storage
+	 * @param [in] data Field data
+	 * @param [in] stride Distance between two blocks in @p data
+	 * @param [in] sel Selection
+	 * @param [in] target Index of the average each selected block contributes to, @c nullptr if all blocks contribute to the same average
+	 * @param [in] numAvg Number of averages
+	 * @param [in] weights Weight of each selected block, the weights of an average sum up to one
+	 */
+	static inline void recordAverage(std::vector<double>& v, double const* data, unsigned int stride, const Selection& sel,
+		unsigned int const* target, unsigned int numAvg, double const* weights)
+	{
+		const unsigned int nEntries = sel.numEntries();
+		const std::size_t offset = v.size();
+		v.resize(offset + numAvg * nEntries, 0.0);
+
+		for (unsigned int i = 0; i < sel.blocks.size(); ++i)
+		{
+			double const* const block = data + sel.blocks[i] * stride;
+			double* const avg = v.data() + offset + (target ? target[i] * nEntries : 0);
+			for (unsigned int e = 0; e < nEntries; ++e)
+				avg[e] += weights[i] * block[sel.entries.empty() ? e : sel.entries[e]];
+		}
 	}
 
 	inline void allocateMemory(const ISolutionExporter& exporter)
@@ -703,26 +1096,40 @@ protected:
 		const unsigned int nAllocTimesteps = std::max(_numTimesteps, detail::numDefaultRecorderTimesteps);
 
 		if (_curCfg->storeOutlet)
-			_curStorage->outlet.reserve(nAllocTimesteps * _nComp * _nOutletPorts);
+			_curStorage->outlet.reserve(nAllocTimesteps * _nRecComp * _nOutletPorts);
 
 		if (_curCfg->storeInlet)
-			_curStorage->inlet.reserve(nAllocTimesteps * _nComp * _nInletPorts);
+			_curStorage->inlet.reserve(nAllocTimesteps * _nRecComp * _nInletPorts);
 
 		if (_curCfg->storeBulk)
-			_curStorage->bulk.reserve(nAllocTimesteps * exporter.numBulkDofs());
+			_curStorage->bulk.reserve(nAllocTimesteps * _bulkSel.blocks.size() * _bulkSel.numEntries());
 		
 		if (_curCfg->storeParticle)
 		{
 			_curStorage->particle.resize(_nParShells.size());
 			for (unsigned int i = 0; i < _nParShells.size(); ++i)
-				_curStorage->particle[i].reserve(nAllocTimesteps * exporter.numParticleMobilePhaseDofs(i));
+				_curStorage->particle[i].reserve(nAllocTimesteps * _particleSel[i].blocks.size() * _particleSel[i].numEntries());
 		}
 		
 		if (_curCfg->storeSolid)
 		{
 			_curStorage->solid.resize(_nParShells.size());
 			for (unsigned int i = 0; i < _nParShells.size(); ++i)
-				_curStorage->solid[i].reserve(nAllocTimesteps * exporter.numSolidPhaseDofs(i));
+				_curStorage->solid[i].reserve(nAllocTimesteps * _solidSel[i].blocks.size() * _solidSel[i].numEntries());
+		}
+
+		if (_curCfg->storeSolidParticleAverage)
+		{
+			_curStorage->solidParticleAvg.resize(_nParShells.size());
+			for (unsigned int i = 0; i < _nParShells.size(); ++i)
+				_curStorage->solidParticleAvg[i].reserve(nAllocTimesteps * _solidSel[i].numAvg * _solidSel[i].numEntries());
+		}
+
+		if (_curCfg->storeSolidColumnAverage)
+		{
+			_curStorage->solidColumnAvg.resize(_nParShells.size());
+			for (unsigned int i = 0; i < _nParShells.size(); ++i)
+				_curStorage->solidColumnAvg[i].reserve(nAllocTimesteps * _solidSel[i].numEntries());
 		}
 
 		if (_curCfg->storeFlux)
@@ -743,20 +1150,20 @@ protected:
 				{
 					for (unsigned int port = 0; port < _nOutletPorts; ++port)
 					{
-						for (unsigned int comp = 0; comp < _nComp; ++comp)
+						for (unsigned int comp = 0; comp < _nRecComp; ++comp)
 						{
 							oss.str("");
 							if ((_nOutletPorts == 1) && !_singleAsMultiPortUnitOps)
 							{
-								oss << prefix << "_OUTLET_COMP_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << comp;
+								oss << prefix << "_OUTLET_COMP_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << componentIndex(comp);
 							}
 							else
 							{
 								oss << prefix << "_OUTLET_PORT_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << port 
-									<<  "_COMP_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << comp;
+									<<  "_COMP_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << componentIndex(comp);
 							}
 
-							writer.template vector<double>(oss.str(), _numTimesteps, _curStorage->outlet.data() + comp + port * _nComp, _nComp * _nOutletPorts);
+							writer.template vector<double>(oss.str(), _numTimesteps, _curStorage->outlet.data() + comp + port * _nRecComp, _nRecComp * _nOutletPorts);
 						}
 					}
 				}
@@ -770,7 +1177,7 @@ protected:
 						else
 							oss << prefix << "_OUTLET_PORT_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << port;
 
-						writer.template matrix<double>(oss.str(), _numTimesteps, _nComp, _curStorage->outlet.data() + port * _nComp, _nOutletPorts * _nComp, _nComp);
+						writer.template matrix<double>(oss.str(), _numTimesteps, _nRecComp, _curStorage->outlet.data() + port * _nRecComp, _nOutletPorts * _nRecComp, _nRecComp);
 					}
 				}
 			}
@@ -778,14 +1185,14 @@ protected:
 			{
 				if (_splitComponents)
 				{
-					for (unsigned int comp = 0; comp < _nComp; ++comp)
+					for (unsigned int comp = 0; comp < _nRecComp; ++comp)
 					{
 						oss.str("");
-						oss << prefix << "_OUTLET_COMP_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << comp;
+						oss << prefix << "_OUTLET_COMP_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << componentIndex(comp);
 						if ((_nOutletPorts == 1) && !_singleAsMultiPortUnitOps)
-							writer.template vector<double>(oss.str(), _numTimesteps, _curStorage->outlet.data() + comp, _nComp);
+							writer.template vector<double>(oss.str(), _numTimesteps, _curStorage->outlet.data() + comp, _nRecComp);
 						else
-							writer.template matrix<double>(oss.str(), _numTimesteps, _nOutletPorts, _curStorage->outlet.data() + comp, _nComp);
+							writer.template matrix<double>(oss.str(), _numTimesteps, _nOutletPorts, _curStorage->outlet.data() + comp, _nRecComp);
 					}
 				}
 				else
@@ -794,12 +1201,12 @@ protected:
 					oss << prefix << "_OUTLET";
 					if ((_nOutletPorts == 1) && !_singleAsMultiPortUnitOps)
 					{
-						const std::vector<std::size_t> layout = {_numTimesteps, _nComp};
+						const std::vector<std::size_t> layout = {_numTimesteps, _nRecComp};
 						writer.template tensor<double>(oss.str(), layout.size(), layout.data(), _curStorage->outlet.data());
 					}
 					else
 					{
-						const std::vector<std::size_t> layout = {_numTimesteps, _nOutletPorts, _nComp};
+						const std::vector<std::size_t> layout = {_numTimesteps, _nOutletPorts, _nRecComp};
 						writer.template tensor<double>(oss.str(), layout.size(), layout.data(), _curStorage->outlet.data());
 					}
 				}
@@ -814,20 +1221,20 @@ protected:
 				{
 					for (unsigned int port = 0; port < _nInletPorts; ++port)
 					{
-						for (unsigned int comp = 0; comp < _nComp; ++comp)
+						for (unsigned int comp = 0; comp < _nRecComp; ++comp)
 						{
 							oss.str("");
 							if ((_nInletPorts == 1) && !_singleAsMultiPortUnitOps)
 							{
-								oss << prefix << "_INLET_COMP_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << comp;
+								oss << prefix << "_INLET_COMP_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << componentIndex(comp);
 							}
 							else
 							{
 								oss << prefix << "_INLET_PORT_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << port 
-									<<  "_COMP_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << comp;
+									<<  "_COMP_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << componentIndex(comp);
 							}
 
-							writer.template vector<double>(oss.str(), _numTimesteps, _curStorage->inlet.data() + comp + port * _nComp, _nComp * _nInletPorts);
+							writer.template vector<double>(oss.str(), _numTimesteps, _curStorage->inlet.data() + comp + port * _nRecComp, _nRecComp * _nInletPorts);
 						}
 					}
 				}
@@ -841,7 +1248,7 @@ protected:
 						else
 							oss << prefix << "_INLET_PORT_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << port;
 
-						writer.template matrix<double>(oss.str(), _numTimesteps, _nComp, _curStorage->inlet.data() + port * _nComp, _nInletPorts * _nComp, _nComp);
+						writer.template matrix<double>(oss.str(), _numTimesteps, _nRecComp, _curStorage->inlet.data() + port * _nRecComp, _nInletPorts * _nRecComp, _nRecComp);
 					}
 				}
 			}
@@ -849,14 +1256,14 @@ protected:
 			{
 				if (_splitComponents)
 				{
-					for (unsigned int comp = 0; comp < _nComp; ++comp)
+					for (unsigned int comp = 0; comp < _nRecComp; ++comp)
 					{
 						oss.str("");
-						oss << prefix << "_INLET_COMP_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << comp;
+						oss << prefix << "_INLET_COMP_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << componentIndex(comp);
 						if ((_nInletPorts == 1) && !_singleAsMultiPortUnitOps)
-							writer.template vector<double>(oss.str(), _numTimesteps, _curStorage->inlet.data() + comp, _nComp);
+							writer.template vector<double>(oss.str(), _numTimesteps, _curStorage->inlet.data() + comp, _nRecComp);
 						else
-							writer.template matrix<double>(oss.str(), _numTimesteps, _nInletPorts, _curStorage->inlet.data() + comp, _nComp);
+							writer.template matrix<double>(oss.str(), _numTimesteps, _nInletPorts, _curStorage->inlet.data() + comp, _nRecComp);
 					}
 				}
 				else
@@ -865,12 +1272,12 @@ protected:
 					oss << prefix << "_INLET";
 					if ((_nInletPorts == 1) && !_singleAsMultiPortUnitOps)
 					{
-						const std::vector<std::size_t> layout = {_numTimesteps, _nComp};
+						const std::vector<std::size_t> layout = {_numTimesteps, _nRecComp};
 						writer.template tensor<double>(oss.str(), layout.size(), layout.data(), _curStorage->inlet.data());
 					}
 					else
 					{
-						const std::vector<std::size_t> layout = {_numTimesteps, _nInletPorts, _nComp};
+						const std::vector<std::size_t> layout = {_numTimesteps, _nInletPorts, _nRecComp};
 						writer.template tensor<double>(oss.str(), layout.size(), layout.data(), _curStorage->inlet.data());
 					}
 				}
@@ -929,6 +1336,34 @@ protected:
 			}
 		}
 
+		if (_curCfg->storeSolidParticleAverage)
+		{
+			for (unsigned int parType = 0; parType < _nParShells.size(); ++parType)
+			{
+				std::vector<std::size_t>& pl = _solidParAvgLayout[parType];
+				oss.str("");
+				if (_nParShells.size() <= 1)
+					oss << prefix << "_SOLID_PARTICLE_AVERAGE";
+				else
+					oss << prefix << "_SOLID_PARTICLE_AVERAGE_PARTYPE_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << parType;
+				pl[0] = _numTimesteps;
+				writer.template tensor<double>(oss.str(), pl.size(), pl.data(), _curStorage->solidParticleAvg[parType].data());
+			}
+		}
+
+		if (_curCfg->storeSolidColumnAverage)
+		{
+			for (unsigned int parType = 0; parType < _nParShells.size(); ++parType)
+			{
+				oss.str("");
+				if (_nParShells.size() <= 1)
+					oss << prefix << "_SOLID_COLUMN_AVERAGE";
+				else
+					oss << prefix << "_SOLID_COLUMN_AVERAGE_PARTYPE_" << std::setfill('0') << std::setw(3) << std::setprecision(0) << parType;
+				writer.template matrix<double>(oss.str(), _numTimesteps, _solidSel[parType].numEntries(), _curStorage->solidColumnAvg[parType].data(), 1);
+			}
+		}
+
 		if (_curCfg->storeFlux)
 		{
 			oss.str("");
@@ -960,6 +1395,12 @@ protected:
 
 		s.flux.clear();
 		s.volume.clear();
+
+		for (auto& v : s.solidParticleAvg)
+			v.clear();
+
+		for (auto& v : s.solidColumnAvg)
+			v.clear();
 	}
 
 	StorageConfig _cfgSolution;
@@ -984,6 +1425,7 @@ protected:
 	std::vector<std::size_t> _bulkLayout;
 	std::vector<std::vector<std::size_t>> _particleLayout;
 	std::vector<std::vector<std::size_t>> _solidLayout;
+	std::vector<std::vector<std::size_t>> _solidParAvgLayout;
 	std::vector<std::size_t> _fluxLayout;
 
 	unsigned int _nComp;
@@ -1005,6 +1447,21 @@ protected:
 	std::vector<double> _axialCoords;
 	std::vector<double> _radialCoords;
 	std::vector<double> _particleCoords;
+
+	std::vector<unsigned int> _axialCells; //!< Indices of recorded axial cells, empty for all cells
+	std::vector<unsigned int> _particleShells; //!< Indices of recorded particle shells, empty for all shells
+	std::vector<unsigned int> _components; //!< Indices of recorded components, empty for all components
+	unsigned int _nRecComp; //!< Number of recorded components
+	Selection _bulkSel; //!< Recorded part of the bulk mobile phase
+	std::vector<Selection> _particleSel; //!< Recorded part of the particle mobile phase per particle type
+	std::vector<Selection> _solidSel; //!< Recorded part of the solid phase per particle type
+
+	unsigned int _recordEvery; //!< Records every k-th time point
+	double _recordMinDt; //!< Minimum time difference between two recorded time points
+	unsigned int _numReceivedTimesteps; //!< Number of received (recorded or skipped) time points
+	unsigned int _numExpectedTimesteps; //!< Number of time points announced at the start of the integration, @c 0 if unknown
+	double _lastRecordedTime; //!< Last recorded time point
+	bool _skipTimestep; //!< Determines whether the current time point is skipped
 };
 
 
@@ -1033,6 +1490,9 @@ public:
 
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->clear();
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->clear();
 	}
 
 	virtual void prepare(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps)
@@ -1045,6 +1505,9 @@ public:
 
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->prepare(numDofs, numSens, numTimesteps);
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->prepare(numDofs, numSens, numTimesteps);
 	}
 
 	virtual void notifyIntegrationStart(unsigned int numDofs, unsigned int numSens, unsigned int numTimesteps)
@@ -1059,6 +1522,9 @@ public:
 
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->notifyIntegrationStart(numDofs, numSens, numTimesteps);
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->notifyIntegrationStart(numDofs, numSens, numTimesteps);
 	}
 
 	virtual void unitOperationStructure(UnitOpIdx idx, const IModel& model, const ISolutionExporter& exporter)
@@ -1068,6 +1534,9 @@ public:
 
 		// Reset for counting actual number of time steps
 		_numTimesteps = 0;
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->unitOperationStructure(idx, model, exporter);
 	}
 
 	virtual void beginTimestep(double t)
@@ -1078,72 +1547,108 @@ public:
 
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->beginTimestep(t);
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->beginTimestep(t);
 	}
 
 	virtual void beginUnitOperation(cadet::UnitOpIdx idx, const cadet::IModel& model, const cadet::ISolutionExporter& exporter)
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->beginUnitOperation(idx, model, exporter);
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->beginUnitOperation(idx, model, exporter);
 	}
 
 	virtual void endUnitOperation()
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->endUnitOperation();
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->endUnitOperation();
 	}
 
 	virtual void endTimestep()
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->endTimestep();
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->endTimestep();
 	}
 
 	virtual void beginSolution()
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->beginSolution();
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->beginSolution();
 	}
 
 	virtual void endSolution()
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->endSolution();
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->endSolution();
 	}
 
 	virtual void beginSolutionDerivative()
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->beginSolutionDerivative();
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->beginSolutionDerivative();
 	}
 
 	virtual void endSolutionDerivative()
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->endSolutionDerivative();
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->endSolutionDerivative();
 	}
 
 	virtual void beginSensitivity(const cadet::ParameterId& pId, unsigned int sensIdx)
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->beginSensitivity(pId, sensIdx);
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->beginSensitivity(pId, sensIdx);
 	}
 
 	virtual void endSensitivity(const cadet::ParameterId& pId, unsigned int sensIdx)
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->endSensitivity(pId, sensIdx);
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->endSensitivity(pId, sensIdx);
 	}
 
 	virtual void beginSensitivityDerivative(const cadet::ParameterId& pId, unsigned int sensIdx)
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->beginSensitivityDerivative(pId, sensIdx);
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->beginSensitivityDerivative(pId, sensIdx);
 	}
 
 	virtual void endSensitivityDerivative(const cadet::ParameterId& pId, unsigned int sensIdx)
 	{
 		for (InternalStorageUnitOpRecorder* rec : _recorders)
 			rec->endSensitivityDerivative(pId, sensIdx);
+
+		for (ISolutionRecorder* rec : _listeners)
+			rec->endSensitivityDerivative(pId, sensIdx);
 	}
 
 	template <typename Writer_t>
@@ -1230,6 +1735,18 @@ public:
 		_recorders.push_back(rec);
 	}
 
+	/**
+	 * @brief Adds a recorder that is notified of all events passed to this recorder
+	 * @details The listener is not owned by this object and has to outlive it or be removed by clearListeners().
+	 * @param [in] rec Recorder that is notified
+	 */
+	inline void addListener(ISolutionRecorder* rec)
+	{
+		_listeners.push_back(rec);
+	}
+
+	inline void clearListeners() CADET_NOEXCEPT { _listeners.clear(); }
+
 	inline unsigned int numRecorders() const CADET_NOEXCEPT { return _recorders.size(); }
 	inline InternalStorageUnitOpRecorder* recorder(unsigned int idx) CADET_NOEXCEPT { return _recorders[idx]; }
 	inline InternalStorageUnitOpRecorder* const recorder(unsigned int idx) const CADET_NOEXCEPT { return _recorders[idx]; }
@@ -1265,6 +1782,7 @@ public:
 protected:
 
 	std::vector<InternalStorageUnitOpRecorder*> _recorders;
+	std::vector<ISolutionRecorder*> _listeners; //!< Additional recorders that are notified (not owned)
 	unsigned int _numTimesteps;
 	unsigned int _numSens;
 	std::vector<double> _time;
@@ -0,0 +1,94 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file 
+ * Defines options that control how datasets are stored by a writer.
+ */
+
+#ifndef LIBCADET_STORAGEOPTIONS_HPP_
+#define LIBCADET_STORAGEOPTIONS_HPP_
+
+#include <string>
+#include <cstddef>
+
+namespace cadet
+{
+
+namespace io
+{
+
+/**
+ * @brief Compression algorithm applied to datasets
+ */
+enum class Compression : int
+{
+	None,
+	Deflate,
+	LZ4,
+	Zstd
+};
+
+/**
+ * @brief Floating point precision of stored datasets
+ */
+enum class Precision : int
+{
+	Double,
+	Single
+};
+
+/**
+ * @brief Options that control how a dataset is stored
+ * @details Writers that do not support some of the options silently ignore them.
+ */
+struct StorageOptions
+{
+	Compression compression; //!< Compression algorithm
+	int compressionLevel; //!< Compression level, negative for the default level of the algorithm (ignored by LZ4)
+	bool shuffle; //!< Determines whether bytes are shuffled before compression
+	std::size_t chunkSize; //!< Target size of a chunk in bytes (chunks span whole time points), @c 0 for one chunk per dataset
+	Precision precision; //!< Precision of floating point datasets
+	int quantizationDigits; //!< Number of decimal digits kept in floating point datasets, negative for lossless storage
+
+	StorageOptions() : compression(Compression::Deflate), compressionLevel(-1), shuffle(false), chunkSize(0),
+		precision(Precision::Double), quantizationDigits(-1) { }
+};
+
+/**
+ * @brief Storage options applied to all datasets whose name starts with a given prefix
+ */
+struct DatasetStorageOptions
+{
+	std::string prefix; //!< Prefix of the dataset names (without group path)
+	StorageOptions options; //!< Storage options
+};
+
+/**
+ * @brief Returns the given storage options without lossy settings
+ * @details Keeps compression and chunking, but stores floating point data in double precision
+ *          without quantization.
+ * @param [in] opts Storage options
+ * @return Lossless storage options
+ */
+inline StorageOptions losslessStorageOptions(StorageOptions opts)
+{
+	opts.precision = Precision::Double;
+	opts.quantizationDigits = -1;
+	return opts;
+}
+
+} // namespace io
+
+} // namespace cadet
+
+#endif  // LIBCADET_STORAGEOPTIONS_HPP_
@@ -0,0 +1,326 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#ifndef HDF5CACHEDREADER_HPP_
+#define HDF5CACHEDREADER_HPP_
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+#include "cadet/cadetCompilerInfo.hpp"
+
+#include "HDF5Reader.hpp"
+
+namespace cadet
+{
+
+namespace io
+{
+
+/**
+ * @brief HDF5 reader that indexes the file once and caches small datasets
+ * @details When a file is opened, all groups and datasets are visited once and their types
+ *          and shapes are stored in an in-memory index. Queries (e.g., exists(), isVector())
+ *          are answered from the index without touching the file. Datasets are read lazily
+ *          on first access and kept in memory if they are small. Large datasets are read from
+ *          the file on every access.
+ *
+ *          The reader assumes that the file is not modified while it is open.
+ */
+class HDF5CachedReader : public HDF5Reader
+{
+public:
+	/// \brief Constructor
+	HDF5CachedReader();
+
+	/// \brief Destructor
+	~HDF5CachedReader() CADET_NOEXCEPT;
+
+	/// \brief Open an HDF5 file and build the index of its contents
+	inline void openFile(const std::string& fileName, const std::string& mode = "r");
+	inline void openFile(const char* fileName, const std::string& mode = "r") { openFile(std::string(fileName), mode); }
+
+	/// \brief Close the currently opened file and clear the cache
+	inline void closeFile();
+
+	/// \brief Convenience wrapper for reading vectors
+	template <typename T>
+	std::vector<T> vector(const std::string& dataSetName);
+
+	/// \brief Convenience wrapper for reading scalars
+	template <typename T>
+	T scalar(const std::string& dataSetName, size_t position = 0);
+
+	/// \brief Checks if the given dataset or group exists in the file
+	inline bool exists(const std::string& elementName) { return find(elementName) != nullptr; }
+	inline bool exists(const char* elementName) { return exists(std::string(elementName)); }
+
+	/// \brief Checks if the given dataset is a vector (i.e., has more than one value)
+	inline bool isVector(const std::string& elementName);
+	inline bool isVector(const char* elementName) { return isVector(std::string(elementName)); }
+
+	/// \brief Checks if the given dataset is a string
+	inline bool isString(const std::string& elementName) { return dataset(elementName).isString; }
+	inline bool isString(const char* elementName) { return isString(std::string(elementName)); }
+
+	/// \brief Checks if the given dataset is a signed int
+	inline bool isInt(const std::string& elementName) { return dataset(elementName).isInt; }
+	inline bool isInt(const char* elementName) { return isInt(std::string(elementName)); }
+
+	/// \brief Checks if the given dataset is a double
+	inline bool isDouble(const std::string& elementName) { return dataset(elementName).isDouble; }
+	inline bool isDouble(const char* elementName) { return isDouble(std::string(elementName)); }
+
+	/// \brief Checks whether the given element is a group
+	inline bool isGroup(const std::string& elementName);
+	inline bool isGroup(const char* elementName) { return isGroup(std::string(elementName)); }
+
+	/// \brief Returns the dimensions of the tensor identified by name
+	inline std::vector<size_t> tensorDimensions(const std::string& elementName) { return dataset(elementName).dims; }
+	inline std::vector<size_t> tensorDimensions(const char* elementName) { return tensorDimensions(std::string(elementName)); }
+
+	/// \brief Returns the number of elements in the array identified by name
+	inline size_t arraySize(const std::string& elementName) { return dataset(elementName).numElements; }
+	inline size_t arraySize(const char* elementName) { return arraySize(std::string(elementName)); }
+
+	/// \brief Sets the maximum number of elements of a dataset for being cached
+	inline void maxCachedElements(size_t maxElements) { _maxCachedElements = maxElements; }
+
+	/// \brief Returns the number of indexed groups and datasets
+	inline size_t numIndexedItems() const { return _index.size(); }
+
+private:
+
+	/// \brief Metadata of a group or dataset
+	struct Item
+	{
+		bool isGroup;
+		bool isString;
+		bool isInt;
+		bool isDouble;
+		std::vector<size_t> dims;
+		size_t numElements;
+	};
+
+	std::unordered_map<std::string, Item> _index; //!< Maps full path to metadata of the group or dataset
+	std::unordered_map<std::string, std::vector<double>> _doubleCache; //!< Maps full path to cached double data
+	std::unordered_map<std::string, std::vector<int>> _intCache; //!< Maps full path to cached int data
+	std::unordered_map<std::string, std::vector<uint64_t>> _uint64Cache; //!< Maps full path to cached uint64_t data
+	std::unordered_map<std::string, std::vector<std::string>> _stringCache; //!< Maps full path to cached string data
+	size_t _maxCachedElements; //!< Maximum number of elements of a cached dataset
+
+	inline std::string fullPath(const std::string& elementName) const;
+	inline Item const* find(const std::string& elementName) const;
+	inline const Item& dataset(const std::string& elementName);
+	inline void buildIndex();
+
+	/// \brief Returns the data of the given dataset from the cache, which is filled on first access
+	template <typename T>
+	const std::vector<T>& cachedVector(const std::string& dataSetName);
+
+	static herr_t indexItem(hid_t root, const char* name, const H5L_info_t* info, void* data);
+
+	inline std::unordered_map<std::string, std::vector<double>>& cache(double*) { return _doubleCache; }
+	inline std::unordered_map<std::string, std::vector<int>>& cache(int*) { return _intCache; }
+	inline std::unordered_map<std::string, std::vector<uint64_t>>& cache(uint64_t*) { return _uint64Cache; }
+	inline std::unordered_map<std::string, std::vector<std::string>>& cache(std::string*) { return _stringCache; }
+};
+
+
+HDF5CachedReader::HDF5CachedReader() : _maxCachedElements(65536) { }
+
+HDF5CachedReader::~HDF5CachedReader() CADET_NOEXCEPT { }
+
+
+void HDF5CachedReader::openFile(const std::string& fileName, const std::string& mode)
+{
+	HDF5Base::openFile(fileName, mode);
+	buildIndex();
+}
+
+
+void HDF5CachedReader::closeFile()
+{
+	HDF5Base::closeFile();
+
+	_index.clear();
+	_doubleCache.clear();
+	_intCache.clear();
+	_uint64Cache.clear();
+	_stringCache.clear();
+}
+
+
+template <typename T>
+std::vector<T> HDF5CachedReader::vector(const std::string& dataSetName)
+{
+	const Item& item = dataset(dataSetName);
+
+	// Read large datasets directly from file
+	if (item.numElements > _maxCachedElements)
+		return HDF5Reader::vector<T>(dataSetName);
+
+	return cachedVector<T>(dataSetName);
+}
+
+
+template <typename T>
+T HDF5CachedReader::scalar(const std::string& dataSetName, size_t position)
+{
+	const Item& item = dataset(dataSetName);
+	if (position >= item.numElements)
+		throw IOException("Index " + std::to_string(position) + " exceeds size of field \"" + dataSetName + "\" in group " + getFullGroupName());
+
+	// Read large datasets directly from file
+	if (item.numElements > _maxCachedElements)
+		return HDF5Reader::vector<T>(dataSetName)[position];
+
+	return cachedVector<T>(dataSetName)[position];
+}
+
+
+template <typename T>
+const std::vector<T>& HDF5CachedReader::cachedVector(const std::string& dataSetName)
+{
+	std::unordered_map<std::string, std::vector<T>>& c = cache(static_cast<T*>(nullptr));
+	const std::string path = fullPath(dataSetName);
+	typename std::unordered_map<std::string, std::vector<T>>::const_iterator it = c.find(path);
+	if (it == c.end())
+		it = c.emplace(path, HDF5Reader::vector<T>(dataSetName)).first;
+
+	return it->second;
+}
+
+
+bool HDF5CachedReader::isVector(const std::string& elementName)
+{
+	Item const* const item = find(elementName);
+	if (!item || item->isGroup)
+		return false;
+
+	return item->numElements > 1;
+}
+
+
+bool HDF5CachedReader::isGroup(const std::string& elementName)
+{
+	Item const* const item = find(elementName);
+	if (!item)
+		throw IOException("Field \"" + elementName + "\" does not exist in group " + getFullGroupName());
+
+	return item->isGroup;
+}
+
+
+std::string HDF5CachedReader::fullPath(const std::string& elementName) const
+{
+	std::string path;
+	for (std::vector<std::string>::const_iterator it = _groupNames.begin(); it < _groupNames.end(); ++it)
+	{
+		if (*it != "/")
+			path += *it;
+	}
+	return path + "/" + elementName;
+}
+
+
+HDF5CachedReader::Item const* HDF5CachedReader::find(const std::string& elementName) const
+{
+	const std::unordered_map<std::string, Item>::const_iterator it = _index.find(fullPath(elementName));
+	if (it == _index.end())
+		return nullptr;
+
+	return &it->second;
+}
+
+
+const HDF5CachedReader::Item& HDF5CachedReader::dataset(const std::string& elementName)
+{
+	Item const* const item = find(elementName);
+	if (!item)
+		throw IOException("Field \"" + elementName + "\" does not exist in group " + getFullGroupName());
+
+	if (item->isGroup)
+		throw IOException("Field \"" + elementName + "\" in group " + getFullGroupName() + " is not a dataset");
+
+	return *item;
+}
+
+
+void HDF5CachedReader::buildIndex()
+{
+	_index.clear();
+	H5Lvisit(_file, H5_INDEX_NAME, H5_ITER_NATIVE, &HDF5CachedReader::indexItem, this);
+}
+
+
+herr_t HDF5CachedReader::indexItem(hid_t root, const char* name, const H5L_info_t* info, void* data)
+{
+	HDF5CachedReader* const reader = static_cast<HDF5CachedReader*>(data);
+
+	const hid_t obj = H5Oopen(root, name, H5P_DEFAULT);
+	if (obj < 0)
+		return 0;
+
+	Item item;
+	item.isGroup = (H5Iget_type(obj) == H5I_GROUP);
+	item.isString = false;
+	item.isInt = false;
+	item.isDouble = false;
+	item.numElements = 0;
+
+	if (H5Iget_type(obj) == H5I_DATASET)
+	{
+		// Determine the datatype
+		const hid_t dataType = H5Dget_type(obj);
+		const hid_t nativeType = H5Tget_native_type(dataType, H5T_DIR_ASCEND);
+
+		item.isString = (H5Tis_variable_str(dataType) > 0) || (H5Tget_class(dataType) == H5T_STRING);
+		item.isInt = H5Tequal(nativeType, H5T_NATIVE_INT) > 0;
+		item.isDouble = H5Tequal(nativeType, H5T_NATIVE_DOUBLE) > 0;
+
+		H5Tclose(nativeType);
+		H5Tclose(dataType);
+
+		// Determine the shape
+		const hid_t dataSpace = H5Dget_space(obj);
+		const int rank = H5Sget_simple_extent_ndims(dataSpace);
+		if (rank > 0)
+		{
+			std::vector<hsize_t> buffer(rank);
+			H5Sget_simple_extent_dims(dataSpace, buffer.data(), nullptr);
+			item.dims.assign(buffer.begin(), buffer.end());
+		}
+		item.numElements = H5Sget_simple_extent_npoints(dataSpace);
+
+		H5Sclose(dataSpace);
+	}
+	else if (!item.isGroup)
+	{
+		// Skip other objects (e.g., named datatypes)
+		H5Oclose(obj);
+		return 0;
+	}
+
+	H5Oclose(obj);
+
+	reader->_index.emplace("/" + std::string(name), item);
+	return 0;
+}
+
+}  // namespace io
+
+}  // namespace cadet
+
+
+#endif /* HDF5CACHEDREADER_HPP_ */
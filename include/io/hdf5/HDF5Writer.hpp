@@ -16,9 +16,11 @@
 #include <vector>
 #include <string>
 #include <cstring>
+#include <algorithm>
 
 #include "cadet/cadetCompilerInfo.hpp"
 #include "common/CompilerSpecific.hpp"
+#include "io/StorageOptions.hpp"
 #include "HDF5Base.hpp"
 
 namespace cadet
@@ -85,16 +87,39 @@ public:
 	///        (maxsize = unlimited, chunked layout), when set to true.
 	inline void extendibleFields(bool setExtendible) {_writeExtendible = setExtendible;}
 
+	/// \brief Sets the storage options (compression, chunking, precision) of datasets
+	/// \details Datasets use the options of the longest matching prefix in @p datasetOpts,
+	///          or @p defaultOpts if no prefix matches. Compression and shuffling are only
+	///          applied if compression is enabled (see compressFields()).
+	inline void storageOptions(const StorageOptions& defaultOpts, const std::vector<DatasetStorageOptions>& datasetOpts)
+	{
+		_defaultOptions = defaultOpts;
+		_datasetOptions = datasetOpts;
+	}
+
+	/// \brief Returns whether the filter plugin of the given compression algorithm was requested but not available
+	/// \details In this case, the affected datasets have been compressed by deflate with byte shuffling.
+	inline bool compressionUnavailable(Compression comp) const
+	{
+		return std::find(_unavailableCompression.begin(), _unavailableCompression.end(), comp) != _unavailableCompression.end();
+	}
+
 private:
 
 	void writeWork(const std::string& dataSetName, hid_t memType, hid_t fileType, const size_t rank, const size_t* dims, const void* buffer, const size_t stride, const size_t blockSize);
 
+	inline const StorageOptions& storageOptions(const std::string& dataSetName) const;
+	inline void setCompressionFilters(hid_t propList, const StorageOptions& opts);
+
 	bool                    _writeScalar;
 	bool                    _writeExtendible;
 	bool                    _writeCompressed;
 	hsize_t*                _maxDims;
 	hsize_t*                _chunks;
 	double                  _chunkFactor;
+	StorageOptions          _defaultOptions;
+	std::vector<DatasetStorageOptions> _datasetOptions;
+	std::vector<Compression> _unavailableCompression;
 };
 
 
@@ -255,18 +280,108 @@ void HDF5Writer::unlinkDataset(const std::string& dsName)
 }
 
 
+const StorageOptions& HDF5Writer::storageOptions(const std::string& dataSetName) const
+{
+	// Find longest matching prefix
+	StorageOptions const* opts = &_defaultOptions;
+	std::size_t matchLength = 0;
+	for (const DatasetStorageOptions& dso : _datasetOptions)
+	{
+		if ((dso.prefix.size() >= matchLength) && (dataSetName.compare(0, dso.prefix.size(), dso.prefix) == 0))
+		{
+			opts = &dso.options;
+			matchLength = dso.prefix.size();
+		}
+	}
+	return *opts;
+}
+
+
+void HDF5Writer::setCompressionFilters(hid_t propList, const StorageOptions& opts)
+{
+	// IDs of third-party filters registered with The HDF Group
+	const H5Z_filter_t filterLZ4 = 32004;
+	const H5Z_filter_t filterZstd = 32015;
+
+	if (opts.compression == Compression::LZ4)
+	{
+		if (H5Zfilter_avail(filterLZ4) > 0)
+		{
+			// The LZ4 filter does not have a compression level (its only parameter is the block size)
+			if (opts.shuffle)
+				H5Pset_shuffle(propList);
+			H5Pset_filter(propList, filterLZ4, H5Z_FLAG_OPTIONAL, 0, nullptr);
+			return;
+		}
+	}
+	else if (opts.compression == Compression::Zstd)
+	{
+		if (H5Zfilter_avail(filterZstd) > 0)
+		{
+			const unsigned int level = (opts.compressionLevel < 0) ? 3 : opts.compressionLevel;
+			if (opts.shuffle)
+				H5Pset_shuffle(propList);
+			H5Pset_filter(propList, filterZstd, H5Z_FLAG_OPTIONAL, 1, &level);
+			return;
+		}
+	}
+	else if (opts.compression == Compression::Deflate)
+	{
+		if (opts.shuffle)
+			H5Pset_shuffle(propList);
+		H5Pset_deflate(propList, (opts.compressionLevel < 0) ? 9 : std::min(opts.compressionLevel, 9));
+		return;
+	}
+	else
+	{
+		if (opts.shuffle)
+			H5Pset_shuffle(propList);
+		return;
+	}
+
+	// Filter plugin is not available, fall back to fast deflate with byte shuffling
+	if (!compressionUnavailable(opts.compression))
+		_unavailableCompression.push_back(opts.compression);
+
+	H5Pset_shuffle(propList);
+	H5Pset_deflate(propList, (opts.compressionLevel < 0) ? 4 : std::max(std::min(opts.compressionLevel, 9), 1));
+}
+
+
 void HDF5Writer::writeWork(const std::string& dataSetName, hid_t memType, hid_t fileType, const size_t rank, const size_t* dims, const void* buffer, const size_t stride, const size_t blockSize)
 {
+	const StorageOptions& opts = storageOptions(dataSetName);
+	const bool isDouble = (H5Tequal(memType, H5T_NATIVE_DOUBLE) > 0);
+	if (isDouble && (opts.precision == Precision::Single))
+		fileType = H5T_IEEE_F32LE;
+
 	hid_t propList = H5Pcreate(H5P_DATASET_CREATE);
 	hid_t dataSpace;
 	if (!_writeScalar)
 	{
-		if (_writeExtendible || _writeCompressed) // we need chunking
+		const bool quantize = isDouble && (opts.quantizationDigits >= 0);
+		const bool filter = quantize || (_writeCompressed && ((opts.compression != Compression::None) || opts.shuffle));
+
+		if (_writeExtendible || filter) // we need chunking
 		{
 			_chunks  = new hsize_t[rank];
 			for (size_t i = 0; i < rank; ++i)
 				_chunks[i] = (_writeExtendible) ? static_cast<hsize_t>(dims[i] * _chunkFactor) : dims[i]; // leave some space in all dims, if extendible
 
+			if ((opts.chunkSize > 0) && (rank > 0))
+			{
+				// Chunks consist of consecutive time points (first dimension) since data is stored time-major
+				hsize_t bytesPerTimePoint = H5Tget_size(fileType);
+				for (size_t i = 1; i < rank; ++i)
+					bytesPerTimePoint *= std::max(_chunks[i], static_cast<hsize_t>(1));
+
+				_chunks[0] = std::min(_chunks[0], std::max(static_cast<hsize_t>(opts.chunkSize / bytesPerTimePoint), static_cast<hsize_t>(1)));
+			}
+
+			// Chunk dimensions have to be positive
+			for (size_t i = 0; i < rank; ++i)
+				_chunks[i] = std::max(_chunks[i], static_cast<hsize_t>(1));
+
 			H5Pset_chunk(propList, rank, _chunks);
 			delete[] _chunks;
 		}
@@ -293,8 +408,12 @@ void HDF5Writer::writeWork(const std::string& dataSetName, hid_t memType, hid_t
 		delete[] convDims;
 		delete[] _maxDims;
 
+		// Filters are applied in order of addition: quantization has to come before shuffling and compression
+		if (quantize)
+			H5Pset_scaleoffset(propList, H5Z_SO_FLOAT_DSCALE, opts.quantizationDigits);
+
 		if (_writeCompressed) // enable compression
-			H5Pset_deflate(propList, 9);
+			setCompressionFilters(propList, opts);
 	}
 	else // reset _writeScalar
 	{
@@ -17,6 +17,7 @@
 
 #include "cadet/cadetCompilerInfo.hpp"
 #include "common/CompilerSpecific.hpp"
+#include "io/StorageOptions.hpp"
 #include "XMLBase.hpp"
 
 namespace cadet
@@ -90,6 +91,14 @@ public:
 	///        (maxsize = unlimited, chunked layout), when set to true.
 	inline void extendibleFields(bool setExtendible) {}
 
+	/// \brief This functionality is not supported by XML - this is a stub.
+	///        Sets the storage options (compression, chunking, precision) of datasets.
+	inline void storageOptions(const StorageOptions& defaultOpts, const std::vector<DatasetStorageOptions>& datasetOpts) {}
+
+	/// \brief This functionality is not supported by XML - this is a stub.
+	///        Returns whether the filter plugin of the given compression algorithm was not available.
+	inline bool compressionUnavailable(Compression comp) const { return false; }
+
 private:
 
 	std::string _typeName;                      //!< Name of the type to be written
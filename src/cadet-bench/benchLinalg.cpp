@@ -0,0 +1,443 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+
+#include <tclap/CmdLine.h>
+#include "common/TclapUtils.hpp"
+
+#include <json.hpp>
+
+#include "linalg/BandMatrix.hpp"
+#include "linalg/DenseMatrix.hpp"
+#include "linalg/SparseMatrix.hpp"
+#include "linalg/CompressedSparseMatrix.hpp"
+#include "linalg/Gmres.hpp"
+
+using json = nlohmann::json;
+
+struct ProgramOptions
+{
+	std::string outFileName;
+	std::string filter;
+	std::string label;
+	int samples;
+};
+
+/**
+ * @brief Timings of a kernel
+ */
+struct Timing
+{
+	double median; //!< Median wall time of a single kernel call in seconds
+	double min; //!< Minimum wall time of a single kernel call in seconds
+	bool ok; //!< Determines whether all kernel calls succeeded
+};
+
+/**
+ * @brief Times a kernel
+ * @details The setup function is called before each kernel call and is not timed.
+ * @param [in] samples Number of timed kernel calls
+ * @param [in] setup Function that prepares a kernel call
+ * @param [in] kernel Function that runs the kernel and returns @c true on success
+ * @return Timings
+ */
+template <typename Setup_t, typename Kernel_t>
+Timing measure(int samples, Setup_t setup, Kernel_t kernel)
+{
+	std::vector<double> times;
+	times.reserve(samples);
+
+	bool ok = true;
+	for (int i = 0; i < samples; ++i)
+	{
+		setup();
+
+		const std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		ok = kernel() && ok;
+		times.push_back(std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count());
+	}
+
+	std::sort(times.begin(), times.end());
+	const std::size_t mid = times.size() / 2;
+	const double median = (times.size() % 2 == 0) ? 0.5 * (times[mid - 1] + times[mid]) : times[mid];
+	return Timing{median, times.front(), ok};
+}
+
+/**
+ * @brief Collects and prints benchmark results
+ */
+class Report
+{
+public:
+	Report(const std::string& filter) : _filter(filter), _results(json::array()) { }
+
+	/**
+	 * @brief Checks whether a benchmark is selected by the filter
+	 * @param [in] name Name of the benchmark
+	 * @return @c true if the benchmark is to be run, otherwise @c false
+	 */
+	inline bool selected(const std::string& name) const { return _filter.empty() || (name.find(_filter) != std::string::npos); }
+
+	/**
+	 * @brief Adds the result of a benchmark
+	 * @param [in] name Name of the benchmark
+	 * @param [in] params Parameters of the benchmark (e.g., matrix size)
+	 * @param [in] t Timings
+	 */
+	void add(const std::string& name, const json& params, const Timing& t)
+	{
+		json r;
+		r["name"] = name;
+		r["params"] = params;
+		r["time_median"] = t.median;
+		r["time_min"] = t.min;
+		r["status"] = t.ok ? "ok" : "failed";
+		_results.push_back(r);
+
+		std::cerr << std::left << std::setw(48) << name << std::right << std::fixed << std::setprecision(3)
+			<< std::setw(14) << t.median * 1e6 << " us" << std::setw(14) << t.min * 1e6 << " us" << (t.ok ? "" : "  FAILED") << "\n";
+	}
+
+	inline const json& results() const CADET_NOEXCEPT { return _results; }
+
+private:
+	std::string _filter;
+	json _results;
+};
+
+/**
+ * @brief Fills a banded matrix with random values such that it is strictly diagonally dominant
+ * @param [in,out] mat Banded matrix
+ * @param [in] gen Random number generator
+ * @tparam Matrix_t Type of banded matrix
+ */
+template <typename Matrix_t>
+void fillDiagonallyDominant(Matrix_t& mat, std::mt19937& gen)
+{
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	const int lower = static_cast<int>(mat.lowerBandwidth());
+	const int upper = static_cast<int>(mat.upperBandwidth());
+	for (unsigned int row = 0; row < mat.rows(); ++row)
+	{
+		for (int diag = -lower; diag <= upper; ++diag)
+		{
+			if ((static_cast<int>(row) + diag < 0) || (static_cast<int>(row) + diag >= static_cast<int>(mat.rows())))
+				continue;
+
+			mat.centered(row, diag) = dist(gen);
+		}
+		mat.centered(row, 0) = static_cast<double>(lower + upper + 1) + std::abs(dist(gen));
+	}
+}
+
+/**
+ * @brief Benchmarks factorization and solution of banded matrices
+ * @details Sizes and bandwidths correspond to the particle blocks of the GRM, the bulk block
+ *          of the GRM, and the full Jacobian of the LRM, all with 4 components and SMA binding
+ *          (1 bound state per component) and WENO order 3.
+ */
+void benchBandMatrix(Report& report, int samples)
+{
+	struct Shape
+	{
+		const char* model;
+		unsigned int cells;
+		unsigned int cellStride;
+		unsigned int lower;
+		unsigned int upper;
+	};
+
+	const Shape shapes[] = {
+		{"grm-particle", 4, 8, 8, 8}, {"grm-particle", 8, 8, 8, 8}, {"grm-particle", 16, 8, 8, 8}, {"grm-particle", 32, 8, 8, 8},
+		{"grm-bulk", 16, 4, 12, 8}, {"grm-bulk", 64, 4, 12, 8}, {"grm-bulk", 256, 4, 12, 8},
+		{"lrm", 16, 8, 24, 16}, {"lrm", 64, 8, 24, 16}, {"lrm", 256, 8, 24, 16}, {"lrm", 1024, 8, 24, 16}
+	};
+
+	std::mt19937 gen(42);
+	for (const Shape& s : shapes)
+	{
+		const unsigned int rows = s.cells * s.cellStride;
+
+		std::ostringstream oss;
+		oss << s.model << "/n" << rows << "/l" << s.lower << "/u" << s.upper;
+		const std::string suffix = oss.str();
+
+		json params;
+		params["rows"] = rows;
+		params["lower_bandwidth"] = s.lower;
+		params["upper_bandwidth"] = s.upper;
+
+		cadet::linalg::BandMatrix bm;
+		bm.resize(rows, s.lower, s.upper);
+		fillDiagonallyDominant(bm, gen);
+
+		cadet::linalg::FactorizableBandMatrix fbm;
+		fbm.resize(rows, s.lower, s.upper);
+
+		const std::string nameFactorize = "band-factorize/" + suffix;
+		if (report.selected(nameFactorize))
+			report.add(nameFactorize, params, measure(samples, [&]() { fbm.copyOver(bm); }, [&]() { return fbm.factorize(); }));
+
+		const std::string nameSolve = "band-solve/" + suffix;
+		if (report.selected(nameSolve))
+		{
+			fbm.copyOver(bm);
+			fbm.factorize();
+
+			std::vector<double> rhs(rows);
+			report.add(nameSolve, params, measure(samples, [&]() { std::fill(rhs.begin(), rhs.end(), 1.0); }, [&]() { return fbm.solve(rhs.data()); }));
+		}
+	}
+}
+
+/**
+ * @brief Benchmarks robust (QR) factorization of dense matrices
+ * @details Sizes correspond to the algebraic systems solved during consistent initialization.
+ */
+void benchDenseMatrix(Report& report, int samples)
+{
+	std::mt19937 gen(42);
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+	for (unsigned int n : {4u, 8u, 16u, 32u, 64u, 128u})
+	{
+		const std::string name = "dense-robust-factorize/n" + std::to_string(n);
+		if (!report.selected(name))
+			continue;
+
+		cadet::linalg::DenseMatrix src;
+		src.resize(n, n);
+		for (unsigned int r = 0; r < n; ++r)
+		{
+			for (unsigned int c = 0; c < n; ++c)
+				src.native(r, c) = dist(gen);
+		}
+
+		cadet::linalg::DenseMatrix dm;
+		dm.resize(n, n);
+		std::vector<double> workspace(dm.robustWorkspaceSize(), 0.0);
+
+		json params;
+		params["rows"] = n;
+
+		report.add(name, params, measure(samples, [&]() { dm.copyFrom(src); }, [&]() { return dm.robustFactorize(workspace.data()); }));
+	}
+}
+
+/**
+ * @brief Creates the sparsity pattern of the bulk block of the GRM2D
+ * @details Each component in a cell is coupled to the same component in the two upstream and the
+ *          next downstream axial cell (WENO order 3) and to the neighboring radial cells.
+ * @param [in] nCol Number of axial cells
+ * @param [in] nRad Number of radial cells
+ * @param [in] nComp Number of components
+ * @param [in] gen Random number generator for element values
+ * @return Sparse matrix in coordinate format
+ */
+cadet::linalg::DoubleSparseMatrix createBulkStencil(unsigned int nCol, unsigned int nRad, unsigned int nComp, std::mt19937& gen)
+{
+	std::uniform_real_distribution<double> dist(-1.0, 1.0);
+	const int strideCol = nRad * nComp;
+	const int strideRad = nComp;
+
+	cadet::linalg::DoubleSparseMatrix sm(nCol * nRad * nComp * 7);
+	for (int col = 0; col < static_cast<int>(nCol); ++col)
+	{
+		for (int rad = 0; rad < static_cast<int>(nRad); ++rad)
+		{
+			for (int comp = 0; comp < static_cast<int>(nComp); ++comp)
+			{
+				const int row = col * strideCol + rad * strideRad + comp;
+				for (int dc = -2; dc <= 1; ++dc)
+				{
+					if ((col + dc >= 0) && (col + dc < static_cast<int>(nCol)))
+						sm.addElement(row, row + dc * strideCol, (dc == 0) ? 10.0 : dist(gen));
+				}
+				if (rad > 0)
+					sm.addElement(row, row - strideRad, dist(gen));
+				if (rad + 1 < static_cast<int>(nRad))
+					sm.addElement(row, row + strideRad, dist(gen));
+			}
+		}
+	}
+	return sm;
+}
+
+/**
+ * @brief Converts a sparse matrix in coordinate format to compressed sparse row format
+ * @param [in] sm Sparse matrix in coordinate format
+ * @param [in] rows Number of rows
+ * @param [out] csm Sparse matrix in compressed sparse row format
+ */
+void toCompressed(const cadet::linalg::DoubleSparseMatrix& sm, unsigned int rows, cadet::linalg::CompressedSparseMatrix& csm)
+{
+	const std::vector<unsigned int>& r = sm.rows();
+	const std::vector<unsigned int>& c = sm.cols();
+	const std::vector<double>& v = sm.values();
+
+	cadet::linalg::SparsityPattern pattern(rows, 7);
+	for (unsigned int i = 0; i < sm.numNonZero(); ++i)
+		pattern.add(r[i], c[i]);
+
+	csm.assignPattern(pattern);
+	for (unsigned int i = 0; i < sm.numNonZero(); ++i)
+		csm(r[i], c[i]) = v[i];
+}
+
+/**
+ * @brief Benchmarks conversion to and multiplication with compressed sparse row matrices
+ * @details Sparsity patterns correspond to the bulk block of the GRM2D with 4 components.
+ */
+void benchSparseMatrix(Report& report, int samples)
+{
+	const unsigned int nComp = 4;
+	const unsigned int shapes[][2] = {{16, 3}, {64, 3}, {64, 8}, {256, 8}, {256, 16}};
+
+	std::mt19937 gen(42);
+	for (const auto& s : shapes)
+	{
+		const unsigned int rows = s[0] * s[1] * nComp;
+		const cadet::linalg::DoubleSparseMatrix sm = createBulkStencil(s[0], s[1], nComp, gen);
+
+		std::ostringstream oss;
+		oss << "/col" << s[0] << "/rad" << s[1];
+		const std::string suffix = oss.str();
+
+		json params;
+		params["rows"] = rows;
+		params["nnz"] = sm.numNonZero();
+
+		cadet::linalg::CompressedSparseMatrix csm;
+
+		const std::string nameConvert = "sparse-to-csr" + suffix;
+		if (report.selected(nameConvert))
+			report.add(nameConvert, params, measure(samples, []() { }, [&]() { toCompressed(sm, rows, csm); return true; }));
+
+		const std::string nameMult = "csr-multiply" + suffix;
+		if (report.selected(nameMult))
+		{
+			toCompressed(sm, rows, csm);
+
+			std::vector<double> x(rows, 1.0);
+			std::vector<double> y(rows, 0.0);
+			report.add(nameMult, params, measure(samples, []() { }, [&]() { csm.multiplyVector(x.data(), y.data()); return true; }));
+		}
+	}
+}
+
+/**
+ * @brief Benchmarks GMRES on a diagonally dominant banded system
+ * @details Sizes correspond to the Schur complement of the GRM with 4 components,
+ *          solved with unrestricted Krylov subspace dimension as configured by default.
+ */
+void benchGmres(Report& report, int samples)
+{
+	const unsigned int nComp = 4;
+
+	std::mt19937 gen(42);
+	for (unsigned int nCol : {16u, 64u, 256u})
+	{
+		const unsigned int rows = nCol * nComp;
+		const std::string name = "gmres-solve/n" + std::to_string(rows);
+		if (!report.selected(name))
+			continue;
+
+		cadet::linalg::BandMatrix bm;
+		bm.resize(rows, 2 * nComp, 2 * nComp);
+		fillDiagonallyDominant(bm, gen);
+
+		cadet::linalg::Gmres gmres;
+		gmres.initialize(rows, 0, cadet::linalg::Orthogonalization::ModifiedGramSchmidt, 10);
+		gmres.matrixVectorMultiplier([](void* userData, double const* x, double* z) -> int
+			{
+				static_cast<const cadet::linalg::BandMatrix*>(userData)->multiplyVector(x, z);
+				return 0;
+			}, &bm);
+
+		const std::vector<double> weight(rows, 1.0);
+		const std::vector<double> rhs(rows, 1.0);
+		std::vector<double> sol(rows, 0.0);
+
+		const int iterBefore = gmres.numIterations();
+		const Timing t = measure(samples, [&]() { std::fill(sol.begin(), sol.end(), 0.0); },
+			[&]() { return gmres.solve(1e-8, weight.data(), rhs.data(), sol.data()) == 0; });
+
+		json params;
+		params["rows"] = rows;
+		params["iterations"] = (gmres.numIterations() - iterBefore) / samples;
+
+		report.add(name, params, t);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	ProgramOptions opts;
+
+	try
+	{
+		TCLAP::CustomOutputWithoutVersion customOut("benchLinalg");
+		TCLAP::CmdLine cmd("Benchmark linear algebra kernels with matrix shapes of the column models", ' ', "1.0");
+		cmd.setOutput(&customOut);
+
+		cmd >> (new TCLAP::ValueArg<std::string>("o", "output", "Write results to JSON file (default: standard output)", false, "", "File"))->storeIn(&opts.outFileName);
+		cmd >> (new TCLAP::ValueArg<std::string>("f", "filter", "Only run benchmarks whose name contains the given string", false, "", "String"))->storeIn(&opts.filter);
+		cmd >> (new TCLAP::ValueArg<std::string>("l", "label", "Label stored in the results (e.g., name of the LAPACK implementation)", false, "", "String"))->storeIn(&opts.label);
+		cmd >> (new TCLAP::ValueArg<int>("n", "samples", "Number of timed calls of each kernel (default: 50)", false, 50, "Int"))->storeIn(&opts.samples);
+
+		cmd.parse(argc, argv);
+	}
+	catch (const TCLAP::ArgException &e)
+	{
+		std::cerr << "ERROR: " << e.error() << " for argument " << e.argId() << std::endl;
+		return 1;
+	}
+
+	opts.samples = std::max(opts.samples, 1);
+
+	std::cerr << std::left << std::setw(48) << "Kernel" << std::right << std::setw(17) << "Median" << std::setw(17) << "Min" << "\n";
+
+	Report report(opts.filter);
+	benchBandMatrix(report, opts.samples);
+	benchDenseMatrix(report, opts.samples);
+	benchSparseMatrix(report, opts.samples);
+	benchGmres(report, opts.samples);
+
+	json doc;
+	doc["label"] = opts.label;
+	doc["samples"] = opts.samples;
+	doc["benchmarks"] = report.results();
+
+	if (opts.outFileName.empty())
+		std::cout << doc.dump(4) << std::endl;
+	else
+	{
+		std::ofstream ofs(opts.outFileName);
+		if (!ofs.good())
+		{
+			std::cerr << "ERROR: Could not write file " << opts.outFileName << std::endl;
+			return 1;
+		}
+		ofs << doc.dump(4) << std::endl;
+	}
+
+	return 0;
+}
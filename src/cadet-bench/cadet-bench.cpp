@@ -0,0 +1,798 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include "cadet/cadet.hpp"
+
+#include <json.hpp>
+
+// Log messages of the driver would distort the timings
+#define CADET_LOGGING_DISABLE
+#include "Logging.hpp"
+
+#define CADET_JSONPARAMETERPROVIDER_NOFORWARD
+#include "common/JsonParameterProvider.hpp"
+#include "common/Driver.hpp"
+
+#include <tclap/CmdLine.h>
+#include "common/TclapUtils.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+	#include <psapi.h>
+#elif !defined(__linux__)
+	#include <sys/resource.h>
+#endif
+
+using json = nlohmann::json;
+
+struct ProgramOptions
+{
+	std::string outFileName;
+	std::string baselineFileName;
+	std::string filter;
+	std::vector<int> threads;
+	int repetitions;
+	int maxLevel;
+	double tolerance;
+	bool listOnly;
+};
+
+/**
+ * @brief Specification of a reference problem
+ */
+struct ProblemSpec
+{
+	std::string name; //!< Unique name of the problem
+	std::string unitShort; //!< Short name of the unit operation model
+	std::string unitType; //!< Unit operation model type as used in the input file
+	int level; //!< Resolution level (1 is coarsest)
+	int nCol; //!< Number of axial cells
+	int nPar; //!< Number of particle cells
+	int nRad; //!< Number of radial cells (GRM2D only)
+	bool series; //!< Determines whether two columns are connected in series (@c true) or a single column is used (@c false)
+	bool sensitivities; //!< Determines whether a forward sensitivity is computed
+};
+
+/**
+ * @brief Result of benchmarking a reference problem with a given number of threads
+ */
+struct CaseResult
+{
+	const ProblemSpec* spec;
+	int nThreads;
+	bool ok;
+	std::string error;
+	std::vector<double> wallTimes; //!< Wall time of time integration of each repetition in seconds
+	long long numDofs;
+	long long numSteps;
+	long long numResEvals;
+	long long numSensResEvals;
+	long long numJacobianEvals;
+	long long peakRss; //!< Peak resident set size in bytes, @c -1 if not available
+};
+
+/**
+ * @brief Resets the peak resident set size of the process
+ * @details Only supported on Linux, where the high water mark is reset via @c /proc/self/clear_refs.
+ *          On other platforms, the peak memory of the whole process so far is reported.
+ * @return @c true if the peak has been reset, otherwise @c false
+ */
+bool resetPeakMemory()
+{
+#if defined(__linux__)
+	std::ofstream ofs("/proc/self/clear_refs");
+	if (!ofs.good())
+		return false;
+
+	ofs << "5";
+	return ofs.good();
+#else
+	return false;
+#endif
+}
+
+/**
+ * @brief Returns the peak resident set size of the process
+ * @return Peak resident set size in bytes, or @c -1 if not available
+ */
+long long peakMemory()
+{
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS pmc;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+		return static_cast<long long>(pmc.PeakWorkingSetSize);
+	return -1;
+#elif defined(__linux__)
+	std::ifstream ifs("/proc/self/status");
+	std::string line;
+	while (std::getline(ifs, line))
+	{
+		if (line.compare(0, 6, "VmHWM:") == 0)
+			return std::stoll(line.substr(6)) * 1024;
+	}
+	return -1;
+#else
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+		return -1;
+
+	// On macOS, ru_maxrss is given in bytes
+	return static_cast<long long>(usage.ru_maxrss);
+#endif
+}
+
+/**
+ * @brief Creates the matrix of reference problems
+ * @details Load-wash-elution with SMA binding on all column models at several resolutions,
+ *          with a single column or two columns in series, and with or without sensitivities.
+ * @param [in] maxLevel Maximum resolution level
+ * @return List of problems
+ */
+std::vector<ProblemSpec> createProblemMatrix(int maxLevel)
+{
+	// Cells per resolution level: {nCol, nPar, nRad}
+	const int gridSizes1D[3][3] = {{16, 4, 1}, {32, 6, 1}, {64, 8, 1}};
+	const int gridSizes2D[3][3] = {{8, 3, 3}, {16, 4, 3}, {32, 4, 5}};
+
+	const char* const units[4][2] = {
+		{"GRM", "GENERAL_RATE_MODEL"},
+		{"LRMP", "LUMPED_RATE_MODEL_WITH_PORES"},
+		{"LRM", "LUMPED_RATE_MODEL_WITHOUT_PORES"},
+		{"GRM2D", "GENERAL_RATE_MODEL_2D"}
+	};
+
+	std::vector<ProblemSpec> problems;
+	for (const auto& unit : units)
+	{
+		const bool is2D = (std::string(unit[0]) == "GRM2D");
+		for (int level = 1; level <= std::min(maxLevel, 3); ++level)
+		{
+			const int* const grid = is2D ? gridSizes2D[level - 1] : gridSizes1D[level - 1];
+			for (int series = 0; series < 2; ++series)
+			{
+				for (int sens = 0; sens < 2; ++sens)
+				{
+					ProblemSpec spec;
+					spec.unitShort = unit[0];
+					spec.unitType = unit[1];
+					spec.level = level;
+					spec.nCol = grid[0];
+					spec.nPar = grid[1];
+					spec.nRad = grid[2];
+					spec.series = series;
+					spec.sensitivities = sens;
+
+					std::ostringstream oss;
+					oss << spec.unitShort << "/L" << level << "/" << (spec.series ? "series" : "single") << "/" << (spec.sensitivities ? "sens" : "nosens");
+					spec.name = oss.str();
+
+					problems.push_back(spec);
+				}
+			}
+		}
+	}
+
+	return problems;
+}
+
+/**
+ * @brief Creates a column with SMA binding for the load-wash-elution problem
+ * @param [in] spec Problem specification
+ * @return Unit operation configuration
+ */
+json createColumn(const ProblemSpec& spec)
+{
+	json config;
+	config["UNIT_TYPE"] = spec.unitType;
+	config["NCOMP"] = 4;
+	config["VELOCITY"] = 5.75e-4;
+	config["COL_DISPERSION"] = 5.75e-8;
+	config["COL_DISPERSION_RADIAL"] = 1e-6;
+	config["FILM_DIFFUSION"] = {6.9e-6, 6.9e-6, 6.9e-6, 6.9e-6};
+	config["PAR_DIFFUSION"] = {7e-10, 6.07e-11, 6.07e-11, 6.07e-11};
+	config["PAR_SURFDIFFUSION"] = {0.0, 0.0, 0.0, 0.0};
+
+	// Geometry
+	config["COL_LENGTH"] = 0.014;
+	config["COL_RADIUS"] = 0.01;
+	config["PAR_RADIUS"] = 4.5e-5;
+	config["COL_POROSITY"] = 0.37;
+	config["PAR_POROSITY"] = 0.75;
+	config["TOTAL_POROSITY"] = 0.37 + (1.0 - 0.37) * 0.75;
+
+	// Initial conditions
+	config["INIT_C"] = {50.0, 0.0, 0.0, 0.0};
+	config["INIT_Q"] = {1.2e3, 0.0, 0.0, 0.0};
+
+	// Adsorption
+	config["ADSORPTION_MODEL"] = std::string("STERIC_MASS_ACTION");
+	{
+		json ads;
+		ads["IS_KINETIC"] = 1;
+		ads["SMA_LAMBDA"] = 1.2e3;
+		ads["SMA_KA"] = {0.0, 35.5, 1.59, 7.7};
+		ads["SMA_KD"] = {0.0, 1000.0, 1000.0, 1000.0};
+		ads["SMA_NU"] = {0.0, 4.7, 5.29, 3.7};
+		ads["SMA_SIGMA"] = {0.0, 11.83, 10.6, 10.0};
+		config["adsorption"] = ads;
+	}
+
+	// Discretization
+	{
+		json disc;
+
+		disc["NCOL"] = spec.nCol;
+		disc["NPAR"] = spec.nPar;
+		disc["NBOUND"] = {1, 1, 1, 1};
+
+		if (spec.unitType == "GENERAL_RATE_MODEL_2D")
+		{
+			disc["NRAD"] = spec.nRad;
+			disc["RADIAL_DISC_TYPE"] = "EQUIDISTANT";
+		}
+
+		disc["PAR_DISC_TYPE"] = std::string("EQUIDISTANT_PAR");
+
+		disc["USE_ANALYTIC_JACOBIAN"] = true;
+		disc["MAX_KRYLOV"] = 0;
+		disc["GS_TYPE"] = 1;
+		disc["MAX_RESTARTS"] = 10;
+		disc["SCHUR_SAFETY"] = 1e-8;
+
+		// WENO
+		{
+			json weno;
+
+			weno["WENO_ORDER"] = 3;
+			weno["BOUNDARY_MODEL"] = 0;
+			weno["WENO_EPS"] = 1e-10;
+			disc["weno"] = weno;
+		}
+		config["discretization"] = disc;
+	}
+
+	return config;
+}
+
+/**
+ * @brief Creates the load-wash-elution inlet
+ * @return Unit operation configuration
+ */
+json createInlet()
+{
+	json inlet;
+
+	inlet["UNIT_TYPE"] = std::string("INLET");
+	inlet["INLET_TYPE"] = std::string("PIECEWISE_CUBIC_POLY");
+	inlet["NCOMP"] = 4;
+
+	const double constCoeff[3][4] = {{50.0, 1.0, 1.0, 1.0}, {50.0, 0.0, 0.0, 0.0}, {100.0, 0.0, 0.0, 0.0}};
+	const double linCoeff[3][4] = {{0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}, {0.2, 0.0, 0.0, 0.0}};
+
+	for (int i = 0; i < 3; ++i)
+	{
+		json sec;
+
+		sec["CONST_COEFF"] = std::vector<double>(constCoeff[i], constCoeff[i] + 4);
+		sec["LIN_COEFF"] = std::vector<double>(linCoeff[i], linCoeff[i] + 4);
+		sec["QUAD_COEFF"] = {0.0, 0.0, 0.0, 0.0};
+		sec["CUBE_COEFF"] = {0.0, 0.0, 0.0, 0.0};
+
+		std::ostringstream oss;
+		oss << "sec_" << std::setfill('0') << std::setw(3) << i;
+		inlet[oss.str()] = sec;
+	}
+
+	return inlet;
+}
+
+/**
+ * @brief Creates the full simulation setup of a reference problem
+ * @details Units are numbered as follows: column (0), inlet (1), second column (2), and outlet (3).
+ *          The second column and the outlet are only present if columns are connected in series.
+ * @param [in] spec Problem specification
+ * @param [in] nThreads Number of threads
+ * @return Simulation setup
+ */
+json createProblem(const ProblemSpec& spec, int nThreads)
+{
+	const bool is2D = (spec.unitType == "GENERAL_RATE_MODEL_2D");
+	const bool isLRM = (spec.unitType == "LUMPED_RATE_MODEL_WITHOUT_PORES");
+
+	json config;
+
+	// Model
+	{
+		json model;
+		model["NUNITS"] = spec.series ? 4 : 2;
+		model["unit_000"] = createColumn(spec);
+		model["unit_001"] = createInlet();
+
+		if (spec.series)
+		{
+			model["unit_002"] = createColumn(spec);
+
+			json outlet;
+			outlet["UNIT_TYPE"] = std::string("OUTLET");
+			outlet["NCOMP"] = 4;
+			model["unit_003"] = outlet;
+		}
+
+		// Valve switches
+		{
+			// Each row: from unit, to unit, from port, to port, from component, to component, flow rate
+			std::vector<double> connections;
+			const auto addConnection = [&](int from, int to, int fromPort, int toPort, double flow)
+			{
+				const double row[7] = {static_cast<double>(from), static_cast<double>(to), static_cast<double>(fromPort), static_cast<double>(toPort), -1.0, -1.0, flow};
+				connections.insert(connections.end(), row, row + 7);
+			};
+
+			if (is2D)
+			{
+				// Flow rates of the radial zones correspond to the interstitial velocity
+				const double flowRate = 7.42637597e-09 * 9.0 / static_cast<double>(spec.nRad * spec.nRad);
+				for (int i = 0; i < spec.nRad; ++i)
+				{
+					// Cross section area of radial zone i is proportional to 2i + 1
+					const double q = flowRate * static_cast<double>(2 * i + 1);
+					addConnection(1, 0, 0, i, q);
+					if (spec.series)
+					{
+						addConnection(0, 2, i, i, q);
+						addConnection(2, 3, i, 0, q);
+					}
+				}
+			}
+			else
+			{
+				addConnection(1, 0, -1, -1, 1.0);
+				if (spec.series)
+				{
+					addConnection(0, 2, -1, -1, 1.0);
+					addConnection(2, 3, -1, -1, 1.0);
+				}
+			}
+
+			json sw;
+			sw["SECTION"] = 0;
+			sw["CONNECTIONS"] = connections;
+
+			json con;
+			con["NSWITCHES"] = 1;
+			con["CONNECTIONS_INCLUDE_PORTS"] = true;
+			con["switch_000"] = sw;
+			model["connections"] = con;
+		}
+
+		// Solver settings
+		{
+			json solver;
+
+			solver["MAX_KRYLOV"] = 0;
+			solver["GS_TYPE"] = 1;
+			solver["MAX_RESTARTS"] = 10;
+			solver["SCHUR_SAFETY"] = 1e-8;
+			model["solver"] = solver;
+		}
+
+		config["model"] = model;
+	}
+
+	// Return
+	{
+		json ret;
+		ret["WRITE_SOLUTION_TIMES"] = true;
+		ret["WRITE_STATISTICS"] = true;
+
+		json unit;
+		unit["WRITE_SOLUTION_BULK"] = false;
+		unit["WRITE_SOLUTION_PARTICLE"] = false;
+		unit["WRITE_SOLUTION_FLUX"] = false;
+		unit["WRITE_SOLUTION_INLET"] = false;
+		unit["WRITE_SOLUTION_OUTLET"] = true;
+		unit["WRITE_SENS_OUTLET"] = spec.sensitivities;
+
+		ret[spec.series ? "unit_002" : "unit_000"] = unit;
+		config["return"] = ret;
+	}
+
+	// Sensitivities with respect to axial dispersion of the first column
+	if (spec.sensitivities)
+	{
+		json param;
+		param["SENS_NAME"] = {"COL_DISPERSION"};
+		param["SENS_UNIT"] = {0};
+		param["SENS_COMP"] = {-1};
+		param["SENS_REACTION"] = {-1};
+		param["SENS_SECTION"] = {-1};
+		param["SENS_BOUNDPHASE"] = {-1};
+		param["SENS_PARTYPE"] = {-1};
+		param["SENS_ABSTOL"] = 1e-6;
+		param["SENS_FACTOR"] = {1.0};
+
+		json sens;
+		sens["NSENS"] = 1;
+		sens["SENS_METHOD"] = std::string("ad1");
+		sens["param_000"] = param;
+		config["sensitivity"] = sens;
+	}
+
+	// Solver
+	{
+		json solver;
+
+		// Lumped rate model without pores has less rate limiting, a shorter simulation time suffices
+		const double endTime = isLRM ? 1100.0 : 1500.0;
+
+		std::vector<double> solTimes;
+		solTimes.reserve(static_cast<std::size_t>(endTime) + 1);
+		for (double t = 0.0; t <= endTime; t += 1.0)
+			solTimes.push_back(t);
+
+		solver["USER_SOLUTION_TIMES"] = solTimes;
+		solver["NTHREADS"] = nThreads;
+
+		// Sections
+		{
+			json sec;
+
+			sec["NSEC"] = 3;
+			sec["SECTION_TIMES"] = {0.0, 10.0, 90.0, endTime};
+			sec["SECTION_CONTINUITY"] = {false, false};
+
+			solver["sections"] = sec;
+		}
+
+		// Time integrator
+		{
+			json ti;
+
+			ti["ABSTOL"] = 1e-8;
+			ti["RELTOL"] = 1e-6;
+			ti["ALGTOL"] = 1e-12;
+			ti["INIT_STEP_SIZE"] = 1e-6;
+			ti["MAX_STEPS"] = 10000;
+			ti["MAX_STEP_SIZE"] = 0.0;
+			ti["RELTOL_SENS"] = 1e-6;
+			ti["ERRORTEST_SENS"] = true;
+			ti["MAX_NEWTON_ITER"] = 3;
+			ti["MAX_ERRTEST_FAIL"] = 7;
+			ti["MAX_CONVTEST_FAIL"] = 10;
+			ti["MAX_NEWTON_ITER_SENS"] = 3;
+			ti["CONSISTENT_INIT_MODE"] = 1;
+			ti["CONSISTENT_INIT_MODE_SENS"] = 1;
+
+			solver["time_integrator"] = ti;
+		}
+
+		config["solver"] = solver;
+	}
+
+	return config;
+}
+
+template <typename T>
+long long sum(const std::vector<T>& v)
+{
+	long long s = 0;
+	for (const T& x : v)
+		s += x;
+	return s;
+}
+
+double median(std::vector<double> v)
+{
+	if (v.empty())
+		return 0.0;
+
+	std::sort(v.begin(), v.end());
+	const std::size_t mid = v.size() / 2;
+	if (v.size() % 2 == 0)
+		return 0.5 * (v[mid - 1] + v[mid]);
+	return v[mid];
+}
+
+/**
+ * @brief Runs a reference problem repeatedly
+ * @param [in] spec Problem specification
+ * @param [in] nThreads Number of threads
+ * @param [in] repetitions Number of repetitions
+ * @return Benchmark result
+ */
+CaseResult runCase(const ProblemSpec& spec, int nThreads, int repetitions)
+{
+	CaseResult res{&spec, nThreads, true, "", {}, 0, 0, 0, 0, 0, -1};
+	res.wallTimes.reserve(repetitions);
+
+	try
+	{
+		const json config = createProblem(spec, nThreads);
+		resetPeakMemory();
+
+		for (int i = 0; i < repetitions; ++i)
+		{
+			cadet::JsonParameterProvider jpp(config);
+			cadet::Driver drv;
+			drv.configure(jpp);
+			drv.run();
+
+			const cadet::ISimulator* const sim = drv.simulator();
+			res.wallTimes.push_back(sim->lastSimulationDuration());
+
+			// Counters are deterministic and only taken from the last repetition
+			const cadet::SolverStatistics& stats = sim->solverStatistics();
+			res.numDofs = sim->numDofs();
+			res.numSteps = sum(stats.numSteps);
+			res.numResEvals = sum(stats.numResEvals);
+			res.numSensResEvals = sum(stats.numSensResEvals);
+
+			// Each factorization is preceded by an evaluation of the Jacobian
+			res.numJacobianEvals = sum(stats.numFactorizations);
+		}
+
+		res.peakRss = peakMemory();
+	}
+	catch (const std::exception& e)
+	{
+		res.ok = false;
+		res.error = e.what();
+	}
+
+	return res;
+}
+
+std::string caseKey(const std::string& name, int nThreads)
+{
+	return name + "@" + std::to_string(nThreads);
+}
+
+json toJson(const CaseResult& res)
+{
+	json c;
+	c["name"] = res.spec->name;
+	c["unit_type"] = res.spec->unitType;
+	c["level"] = res.spec->level;
+	c["ncol"] = res.spec->nCol;
+	c["npar"] = res.spec->nPar;
+	if (res.spec->unitType == "GENERAL_RATE_MODEL_2D")
+		c["nrad"] = res.spec->nRad;
+	c["nunits"] = res.spec->series ? 4 : 2;
+	c["sensitivities"] = res.spec->sensitivities;
+	c["threads"] = res.nThreads;
+	c["status"] = res.ok ? "ok" : "error";
+
+	if (!res.ok)
+	{
+		c["error"] = res.error;
+		return c;
+	}
+
+	c["wall_times"] = res.wallTimes;
+	c["wall_time_median"] = median(res.wallTimes);
+	c["wall_time_min"] = *std::min_element(res.wallTimes.begin(), res.wallTimes.end());
+	c["wall_time_max"] = *std::max_element(res.wallTimes.begin(), res.wallTimes.end());
+	c["num_dofs"] = res.numDofs;
+	c["num_steps"] = res.numSteps;
+	c["num_res_evals"] = res.numResEvals;
+	c["num_sens_res_evals"] = res.numSensResEvals;
+	c["num_jacobian_evals"] = res.numJacobianEvals;
+	c["peak_rss"] = res.peakRss;
+	return c;
+}
+
+/**
+ * @brief Compares the results with a baseline and annotates the cases
+ * @details A case regresses if its median wall time exceeds the baseline by more than the relative tolerance.
+ *          Changes in the number of residual or Jacobian evaluations are reported but do not count as regression.
+ * @param [in,out] cases Results, annotated with baseline values
+ * @param [in] baseline Baseline document
+ * @param [in] tolerance Relative tolerance of the median wall time
+ * @return Number of regressed cases
+ */
+int compareWithBaseline(json& cases, const json& baseline, double tolerance)
+{
+	std::unordered_map<std::string, const json*> baseCases;
+	for (const json& c : baseline.at("cases"))
+	{
+		if (c.at("status").get<std::string>() == "ok")
+			baseCases[caseKey(c.at("name").get<std::string>(), c.at("threads").get<int>())] = &c;
+	}
+
+	int numRegressions = 0;
+	std::cerr << "\nComparison with baseline (tolerance " << tolerance * 100.0 << "%)\n";
+	for (json& c : cases)
+	{
+		if (c.at("status").get<std::string>() != "ok")
+			continue;
+
+		const std::string key = caseKey(c.at("name").get<std::string>(), c.at("threads").get<int>());
+		const auto it = baseCases.find(key);
+		if (it == baseCases.end())
+		{
+			std::cerr << std::left << std::setw(32) << key << " not in baseline\n";
+			continue;
+		}
+
+		const json& base = *it->second;
+		const double baseTime = base.at("wall_time_median").get<double>();
+		const double curTime = c.at("wall_time_median").get<double>();
+		const double change = (baseTime > 0.0) ? curTime / baseTime - 1.0 : 0.0;
+
+		c["baseline_wall_time_median"] = baseTime;
+		c["relative_change"] = change;
+
+		std::string verdict = "ok";
+		if (change > tolerance)
+		{
+			verdict = "REGRESSION";
+			++numRegressions;
+		}
+		else if (change < -tolerance)
+			verdict = "improved";
+
+		c["regression"] = (change > tolerance);
+
+		std::cerr << std::left << std::setw(32) << key << std::right << std::fixed << std::setprecision(3)
+			<< std::setw(10) << baseTime << " s -> " << std::setw(10) << curTime << " s "
+			<< std::showpos << std::setprecision(1) << std::setw(8) << change * 100.0 << "%" << std::noshowpos << "  " << verdict;
+
+		for (const char* counter : {"num_res_evals", "num_jacobian_evals"})
+		{
+			if (base.count(counter) && (base.at(counter).get<long long>() != c.at(counter).get<long long>()))
+				std::cerr << "  (" << counter << " " << base.at(counter).get<long long>() << " -> " << c.at(counter).get<long long>() << ")";
+		}
+		std::cerr << "\n";
+	}
+
+	return numRegressions;
+}
+
+int main(int argc, char** argv)
+{
+	ProgramOptions opts;
+
+	try
+	{
+		TCLAP::CustomOutputWithoutVersion customOut("cadet-bench");
+		TCLAP::CmdLine cmd("Runs reference problems and compares timings with a baseline", ' ', "1.0");
+		cmd.setOutput(&customOut);
+
+		cmd >> (new TCLAP::ValueArg<std::string>("o", "output", "Write results to JSON file (default: standard output)", false, "", "File"))->storeIn(&opts.outFileName);
+		cmd >> (new TCLAP::ValueArg<std::string>("b", "baseline", "Compare results with baseline JSON file", false, "", "File"))->storeIn(&opts.baselineFileName);
+		cmd >> (new TCLAP::ValueArg<double>("t", "tolerance", "Relative increase of median wall time that counts as regression (default: 0.1)", false, 0.1, "Value"))->storeIn(&opts.tolerance);
+		cmd >> (new TCLAP::ValueArg<int>("r", "repetitions", "Number of repetitions of each problem (default: 3)", false, 3, "Int"))->storeIn(&opts.repetitions);
+		cmd >> (new TCLAP::MultiArg<int>("j", "threads", "Number of threads, can be given multiple times (default: 1)", false, "Int"))->storeIn(&opts.threads);
+		cmd >> (new TCLAP::ValueArg<int>("l", "level", "Maximum resolution level from 1 to 3 (default: 2)", false, 2, "Int"))->storeIn(&opts.maxLevel);
+		cmd >> (new TCLAP::ValueArg<std::string>("f", "filter", "Only run problems whose name contains the given string", false, "", "String"))->storeIn(&opts.filter);
+		cmd >> (new TCLAP::SwitchArg("", "list", "List problems and exit"))->storeIn(&opts.listOnly);
+
+		cmd.parse(argc, argv);
+	}
+	catch (const TCLAP::ArgException &e)
+	{
+		std::cerr << "ERROR: " << e.error() << " for argument " << e.argId() << std::endl;
+		return 1;
+	}
+
+	if (opts.threads.empty())
+		opts.threads.push_back(1);
+
+	opts.repetitions = std::max(opts.repetitions, 1);
+
+	std::vector<ProblemSpec> problems = createProblemMatrix(opts.maxLevel);
+	if (!opts.filter.empty())
+	{
+		problems.erase(std::remove_if(problems.begin(), problems.end(), [&](const ProblemSpec& p) { return p.name.find(opts.filter) == std::string::npos; }), problems.end());
+	}
+
+	if (opts.listOnly)
+	{
+		for (const ProblemSpec& p : problems)
+			std::cout << p.name << "\n";
+		return 0;
+	}
+
+	// Read baseline before running to fail early
+	json baseline;
+	if (!opts.baselineFileName.empty())
+	{
+		std::ifstream ifs(opts.baselineFileName);
+		if (!ifs.good())
+		{
+			std::cerr << "ERROR: Could not open baseline file " << opts.baselineFileName << std::endl;
+			return 1;
+		}
+
+		try
+		{
+			ifs >> baseline;
+		}
+		catch (const std::exception& e)
+		{
+			std::cerr << "ERROR: Could not parse baseline file " << opts.baselineFileName << ": " << e.what() << std::endl;
+			return 1;
+		}
+	}
+
+	json cases = json::array();
+	for (const ProblemSpec& p : problems)
+	{
+		for (int nThreads : opts.threads)
+		{
+			std::cerr << std::left << std::setw(32) << caseKey(p.name, nThreads) << std::flush;
+
+			const CaseResult res = runCase(p, nThreads, opts.repetitions);
+			if (res.ok)
+				std::cerr << std::right << std::fixed << std::setprecision(3) << std::setw(10) << median(res.wallTimes) << " s"
+					<< std::setw(10) << res.numResEvals << " res" << std::setw(8) << res.numJacobianEvals << " jac\n";
+			else
+				std::cerr << " ERROR: " << res.error << "\n";
+
+			cases.push_back(toJson(res));
+		}
+	}
+
+	int numRegressions = 0;
+	if (!baseline.is_null())
+	{
+		try
+		{
+			numRegressions = compareWithBaseline(cases, baseline, opts.tolerance);
+		}
+		catch (const std::exception& e)
+		{
+			std::cerr << "ERROR: Invalid baseline file " << opts.baselineFileName << ": " << e.what() << std::endl;
+			return 1;
+		}
+	}
+
+	json doc;
+	doc["version"] = cadet::getLibraryVersion();
+	doc["commit"] = cadet::getLibraryCommitHash();
+	doc["repetitions"] = opts.repetitions;
+	doc["cases"] = cases;
+
+	if (opts.outFileName.empty())
+		std::cout << doc.dump(4) << std::endl;
+	else
+	{
+		std::ofstream ofs(opts.outFileName);
+		if (!ofs.good())
+		{
+			std::cerr << "ERROR: Could not write file " << opts.outFileName << std::endl;
+			return 1;
+		}
+		ofs << doc.dump(4) << std::endl;
+	}
+
+	if (numRegressions > 0)
+	{
+		std::cerr << numRegressions << " regression(s) detected" << std::endl;
+		return 2;
+	}
+
+	return 0;
+}
@@ -11,11 +11,12 @@
 // =============================================================================
 
 #include "cadet/cadet.hpp"
-#include "io/hdf5/HDF5Reader.hpp"
+#include "io/hdf5/HDF5CachedReader.hpp"
 #include "io/hdf5/HDF5Writer.hpp"
 #include "io/xml/XMLReader.hpp"
 #include "io/xml/XMLWriter.hpp"
 #include "common/JsonParameterProvider.hpp"
+#include "common/CompactJsonParameterProvider.hpp"
 
 #include <tclap/CmdLine.h>
 #include "common/TclapUtils.hpp"
@@ -26,6 +27,7 @@
 #include "common/CompilerSpecific.hpp"
 #include "common/ParameterProviderImpl.hpp"
 #include "common/Driver.hpp"
+#include "common/SharedMemoryRecorder.hpp"
 
 #ifdef CADET_BENCHMARK_MODE
 	#include "common/Timer.hpp"
@@ -34,6 +36,8 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <fstream>
+#include <memory>
 #include <cctype>
 
 #ifndef CADET_LOGGING_DISABLE
@@ -67,6 +71,28 @@ public:
 	}
 };
 
+/**
+ * @brief Scope class that enables asynchronous logging on construction and disables it on destruction
+ * @details Pending log messages are delivered on destruction. Hence, the scope has to end before the log receiver is destroyed.
+ */
+class AsyncLogScope
+{
+public:
+	AsyncLogScope(bool enable) : _enabled(enable)
+	{
+		if (_enabled)
+			cadetSetAsyncLogging(1, 65536);
+	}
+
+	~AsyncLogScope() CADET_NOEXCEPT
+	{
+		if (_enabled)
+			cadetSetAsyncLogging(0, 0);
+	}
+private:
+	bool _enabled;
+};
+
 #ifdef CADET_BENCHMARK_MODE
 	/**
 	 * @brief Scope class that starts a timer on construction and stops it on destruction
@@ -178,7 +204,7 @@ public:
 
 	void configure(cadet::Driver& drv, const std::string& inFileName)
 	{
-		cadet::JsonParameterProvider pp = cadet::JsonParameterProvider::fromFile(inFileName);
+		cadet::CompactJsonParameterProvider pp = cadet::CompactJsonParameterProvider::fromFile(inFileName);
 
 		// Skip input scope if it exists
 		if (pp.exists("input"))
@@ -188,8 +214,22 @@ public:
 	}
 };
 
+struct CheckpointOptions
+{
+	std::string file; //!< Name of the checkpoint file, empty if checkpoints are disabled
+	double interval; //!< Minimum wall clock time in seconds between two checkpoints, 0 writes a checkpoint at every section transition
+	bool resume; //!< Determines whether the simulation is resumed from the checkpoint file
+};
+
+struct SharedMemoryOptions
+{
+	std::string name; //!< Name of the shared memory segment, empty if the solution is not published
+	unsigned int capacity; //!< Number of time steps in the ring buffer
+	bool bulk; //!< Determines whether the bulk volume is published
+};
+
 template <class DriverConfigurator_t, class Writer_t>
-void run(const std::string& inFileName, const std::string& outFileName, bool showProgressBar)
+void run(const std::string& inFileName, const std::string& outFileName, bool showProgressBar, const CheckpointOptions& cpOpts, const SharedMemoryOptions& shmOpts)
 {
 	cadet::Driver drv;
 	
@@ -198,6 +238,35 @@ void run(const std::string& inFileName, const std::string& outFileName, bool sho
 		dc.configure(drv, inFileName);
 	}
 
+	if (!cpOpts.file.empty())
+	{
+		if (cpOpts.resume)
+		{
+			if (std::ifstream(cpOpts.file).good())
+			{
+				// Solutions before the checkpoint are not restored, so do not replace a complete output
+				if (std::ifstream(outFileName).good())
+				{
+					Writer_t writer;
+					writer.openFile(outFileName, "r");
+					const bool hasOutput = writer.exists("output");
+					writer.closeFile();
+
+					if (hasOutput)
+						throw cadet::io::IOException("Output file " + outFileName + " already contains /output, which would be replaced by the solution recorded after the checkpoint");
+				}
+
+				std::cout << "Resuming from checkpoint " << cpOpts.file << std::endl;
+				drv.simulator()->resumeFromCheckpoint(cpOpts.file.c_str());
+			}
+			else
+				std::cout << "Checkpoint " << cpOpts.file << " not found, starting from the beginning" << std::endl;
+		}
+
+		drv.simulator()->setCheckpointFile(cpOpts.file.c_str());
+		drv.simulator()->setCheckpointInterval(cpOpts.interval);
+	}
+
 	std::unique_ptr<ProgressBarNotifier> pb = nullptr;
 
 #ifndef CADET_BENCHMARK_MODE
@@ -205,6 +274,16 @@ void run(const std::string& inFileName, const std::string& outFileName, bool sho
 		pb = std::make_unique<ProgressBarNotifier>();
 #endif
 
+#ifdef CADET_SHARED_MEMORY_RECORDER_AVAILABLE
+	std::unique_ptr<cadet::SharedMemoryRecorder> shm = nullptr;
+	if (!shmOpts.name.empty())
+	{
+		shm = std::make_unique<cadet::SharedMemoryRecorder>(shmOpts.name, shmOpts.capacity);
+		shm->storeBulk(shmOpts.bulk);
+		drv.solution()->addListener(shm.get());
+	}
+#endif
+
 	drv.simulator()->setNotificationCallback(pb.get());
 	drv.run();
 
@@ -265,6 +344,9 @@ int main(int argc, char** argv)
 	std::string outFileName = "";
 	cadet::LogLevel logLevel = cadet::LogLevel::Trace;
 	bool showProgressBar = false;
+	CheckpointOptions cpOpts{"", 0.0, false};
+	bool asyncLog = false;
+	SharedMemoryOptions shmOpts{"", 1024, false};
 
 	try
 	{
@@ -273,7 +355,16 @@ int main(int argc, char** argv)
 		cmd.setOutput(&customOut);
 
 		cmd >> (new TCLAP::SwitchArg("", "progress", "Show a progress bar"))->storeIn(&showProgressBar);
+		cmd >> (new TCLAP::ValueArg<std::string>("", "checkpoint", "Write checkpoints at section transitions to file", false, "", "File"))->storeIn(&cpOpts.file);
+		cmd >> (new TCLAP::ValueArg<double>("", "checkpoint-interval", "Minimum number of seconds between two checkpoints (requires --checkpoint, default: 0 = every section transition)", false, 0.0, "Seconds"))->storeIn(&cpOpts.interval);
+		cmd >> (new TCLAP::SwitchArg("", "resume", "Resume from checkpoint file (requires --checkpoint)"))->storeIn(&cpOpts.resume);
+#ifdef CADET_SHARED_MEMORY_RECORDER_AVAILABLE
+		cmd >> (new TCLAP::ValueArg<std::string>("", "shm", "Publish outlet concentrations in shared memory segment", false, "", "Name"))->storeIn(&shmOpts.name);
+		cmd >> (new TCLAP::ValueArg<unsigned int>("", "shm-capacity", "Number of time steps in shared memory ring buffer (default: 1024)", false, 1024, "Int"))->storeIn(&shmOpts.capacity);
+		cmd >> (new TCLAP::SwitchArg("", "shm-bulk", "Also publish bulk concentrations in shared memory (requires --shm)"))->storeIn(&shmOpts.bulk);
+#endif
 		cmd >> (new TCLAP::ValueArg<cadet::LogLevel>("L", "loglevel", "Set the log level", false, cadet::LogLevel::Trace, "LogLevel"))->storeIn(&logLevel);
+		cmd >> (new TCLAP::SwitchArg("", "async-log", "Deliver log messages on a background thread"))->storeIn(&asyncLog);
 		cmd >> (new TCLAP::UnlabeledValueArg<std::string>("input", "Input file", true, "", "File"))->storeIn(&inFileName);
 		cmd >> (new TCLAP::UnlabeledValueArg<std::string>("output", "Output file (defaults to input file)", false, "", "File"))->storeIn(&outFileName);
 
@@ -285,6 +376,18 @@ int main(int argc, char** argv)
 		return 1;
 	}
 
+	if (cpOpts.file.empty() && (cpOpts.resume || (cpOpts.interval != 0.0)))
+	{
+		std::cerr << "ERROR: Options --resume and --checkpoint-interval require --checkpoint" << std::endl;
+		return 1;
+	}
+
+	if (cpOpts.interval < 0.0)
+	{
+		std::cerr << "ERROR: Checkpoint interval has to be non-negative" << std::endl;
+		return 1;
+	}
+
 	// If no dedicated output filename was given, assume output = input file
 	if (outFileName.empty())
 		outFileName = inFileName;
@@ -296,6 +399,7 @@ int main(int argc, char** argv)
 	cadetSetLogReceiver(&lr);
 	cadetSetLogLevel(static_cast<typename std::underlying_type<cadet::LogLevel>::type>(logLevel));
 	setLocalLogLevel(logLevel);
+	AsyncLogScope als(asyncLog);
 
 	// Obtain file extensions for selecting corresponding reader and writer
 	const std::size_t dotPosIn = inFileName.find_last_of('.');
@@ -321,11 +425,11 @@ int main(int argc, char** argv)
 		{
 			if (cadet::util::caseInsensitiveEquals(fileExtOut, "h5"))
 			{
-				run<FileReaderDriverConfigurator<cadet::io::HDF5Reader>, cadet::io::HDF5Writer>(inFileName, outFileName, showProgressBar);
+				run<FileReaderDriverConfigurator<cadet::io::HDF5CachedReader>, cadet::io::HDF5Writer>(inFileName, outFileName, showProgressBar, cpOpts, shmOpts);
 			}
 			else if (cadet::util::caseInsensitiveEquals(fileExtOut, "xml"))
 			{
-				run<FileReaderDriverConfigurator<cadet::io::HDF5Reader>, cadet::io::XMLWriter>(inFileName, outFileName, showProgressBar);
+				run<FileReaderDriverConfigurator<cadet::io::HDF5CachedReader>, cadet::io::XMLWriter>(inFileName, outFileName, showProgressBar, cpOpts, shmOpts);
 			}
 			else
 			{
@@ -337,11 +441,11 @@ int main(int argc, char** argv)
 		{
 			if (cadet::util::caseInsensitiveEquals(fileExtOut, "xml"))
 			{
-				run<FileReaderDriverConfigurator<cadet::io::XMLReader>, cadet::io::XMLWriter>(inFileName, outFileName, showProgressBar);
+				run<FileReaderDriverConfigurator<cadet::io::XMLReader>, cadet::io::XMLWriter>(inFileName, outFileName, showProgressBar, cpOpts, shmOpts);
 			}
 			else if (cadet::util::caseInsensitiveEquals(fileExtOut, "h5"))
 			{
-				run<FileReaderDriverConfigurator<cadet::io::XMLReader>, cadet::io::HDF5Writer>(inFileName, outFileName, showProgressBar);
+				run<FileReaderDriverConfigurator<cadet::io::XMLReader>, cadet::io::HDF5Writer>(inFileName, outFileName, showProgressBar, cpOpts, shmOpts);
 			}
 			else
 			{
@@ -353,11 +457,11 @@ int main(int argc, char** argv)
 		{
 			if (cadet::util::caseInsensitiveEquals(fileExtOut, "xml"))
 			{
-				run<JsonDriverConfigurator, cadet::io::XMLWriter>(inFileName, outFileName, showProgressBar);
+				run<JsonDriverConfigurator, cadet::io::XMLWriter>(inFileName, outFileName, showProgressBar, cpOpts, shmOpts);
 			}
 			else if (cadet::util::caseInsensitiveEquals(fileExtOut, "h5"))
 			{
-				run<JsonDriverConfigurator, cadet::io::HDF5Writer>(inFileName, outFileName, showProgressBar);
+				run<JsonDriverConfigurator, cadet::io::HDF5Writer>(inFileName, outFileName, showProgressBar, cpOpts, shmOpts);
 			}
 			else
 			{
@@ -27,6 +27,7 @@
 
 #include "cadet/cadetCompilerInfo.hpp"
 #include "common/CompilerSpecific.hpp"
+#include "io/StorageOptions.hpp"
 
 #include "MatlabException.hpp"
 
@@ -136,6 +137,12 @@ public:
 	///        (maxsize = unlimited, chunked layout), when set to true.
 	inline void extendibleFields(bool setExtendible) { }
 
+	/// \brief Sets the storage options (compression, chunking, precision) of datasets
+	inline void storageOptions(const cadet::io::StorageOptions& defaultOpts, const std::vector<cadet::io::DatasetStorageOptions>& datasetOpts) { }
+
+	/// \brief Returns whether the filter plugin of the given compression algorithm was not available
+	inline bool compressionUnavailable(cadet::io::Compression comp) const { return false; }
+
 	inline void pushGroup(const std::string& groupName);
 	inline void popGroup();
 
@@ -0,0 +1,876 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include "common/CompactJsonParameterProvider.hpp"
+#include "io/IOException.hpp"
+
+#include <fstream>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+#include <cstdlib>
+#include <cstring>
+
+namespace
+{
+	typedef cadet::CompactJsonParameterProvider::Node Node;
+
+	/**
+	 * @brief Exactly representable powers of ten
+	 */
+	const double powersOfTen[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+
+	inline bool isDigit(char c) CADET_NOEXCEPT { return (c >= '0') && (c <= '9'); }
+
+	/**
+	 * @brief Single pass recursive descent parser that builds a compact JSON tree
+	 * @details Arrays of numbers and booleans are collected in contiguous vectors. Numbers whose
+	 *          significand fits into 53 bits and whose decimal exponent is small are converted
+	 *          exactly without calling the C library (Clinger's fast path).
+	 */
+	class Parser
+	{
+	public:
+		Parser(const char* data, std::size_t len) : _begin(data), _pos(data), _end(data + len) { }
+
+		void parseDocument(Node& root)
+		{
+			skipWhitespace();
+			parseValue(root);
+			skipWhitespace();
+			if (_pos != _end)
+				error("Unexpected characters after JSON document");
+		}
+
+	private:
+		const char* _begin;
+		const char* _pos;
+		const char* _end;
+
+		inline char peek() const CADET_NOEXCEPT { return (_pos < _end) ? *_pos : '\0'; }
+
+		inline void skipWhitespace() CADET_NOEXCEPT
+		{
+			while ((_pos < _end) && ((*_pos == ' ') || (*_pos == '\n') || (*_pos == '\r') || (*_pos == '\t')))
+				++_pos;
+		}
+
+		[[noreturn]] void error(const char* msg) const
+		{
+			throw cadet::io::IOException("JSON parse error at offset " + std::to_string(_pos - _begin) + ": " + msg);
+		}
+
+		inline void expect(char c)
+		{
+			if (peek() != c)
+				error((std::string("Expected '") + c + "'").c_str());
+			++_pos;
+		}
+
+		inline void literal(const char* lit)
+		{
+			const std::size_t len = std::strlen(lit);
+			if ((static_cast<std::size_t>(_end - _pos) < len) || (std::strncmp(_pos, lit, len) != 0))
+				error("Invalid literal");
+			_pos += len;
+		}
+
+		void parseValue(Node& n)
+		{
+			switch (peek())
+			{
+				case '{':
+					parseObject(n);
+					break;
+				case '[':
+					parseArray(n);
+					break;
+				case '"':
+					n.type = Node::Type::String;
+					parseString(n.string);
+					break;
+				case 't':
+					literal("true");
+					n.type = Node::Type::Bool;
+					n.integer = 1;
+					break;
+				case 'f':
+					literal("false");
+					n.type = Node::Type::Bool;
+					n.integer = 0;
+					break;
+				case 'n':
+					literal("null");
+					n.type = Node::Type::Null;
+					break;
+				case '\0':
+					error("Unexpected end of input");
+				default:
+					if (parseNumber(n.integer, n.isUnsigned, n.real))
+						n.type = Node::Type::Int;
+					else
+						n.type = Node::Type::Double;
+					break;
+			}
+		}
+
+		void parseObject(Node& n)
+		{
+			n.type = Node::Type::Object;
+			++_pos;
+
+			skipWhitespace();
+			if (peek() == '}')
+			{
+				++_pos;
+				return;
+			}
+
+			while (true)
+			{
+				skipWhitespace();
+				if (peek() != '"')
+					error("Expected string as object key");
+
+				n.keys.emplace_back();
+				parseString(n.keys.back());
+
+				skipWhitespace();
+				expect(':');
+				skipWhitespace();
+
+				n.children.emplace_back();
+				parseValue(n.children.back());
+
+				skipWhitespace();
+				const char c = peek();
+				++_pos;
+				if (c == '}')
+					break;
+				if (c != ',')
+				{
+					--_pos;
+					error("Expected ',' or '}'");
+				}
+			}
+
+			sortMembers(n);
+		}
+
+		void parseArray(Node& n)
+		{
+			++_pos;
+
+			skipWhitespace();
+			if (peek() == ']')
+			{
+				n.type = Node::Type::Array;
+				++_pos;
+				return;
+			}
+
+			// Collect numbers and booleans in contiguous storage until another type is encountered
+			n.type = Node::Type::IntArray;
+			while (true)
+			{
+				skipWhitespace();
+				const char c = peek();
+				if ((n.type != Node::Type::Array) && ((c == '-') || isDigit(c) || (c == 't') || (c == 'f')))
+					appendNumeric(n, c);
+				else
+				{
+					if (n.type != Node::Type::Array)
+						convertToGenericArray(n);
+
+					n.children.emplace_back();
+					parseValue(n.children.back());
+				}
+
+				skipWhitespace();
+				const char d = peek();
+				++_pos;
+				if (d == ']')
+					break;
+				if (d != ',')
+				{
+					--_pos;
+					error("Expected ',' or ']'");
+				}
+			}
+		}
+
+		inline void appendNumeric(Node& n, char c)
+		{
+			int64_t integer = 0;
+			bool isUnsigned = false;
+			double real = 0.0;
+			bool isInt = true;
+
+			if (c == 't')
+			{
+				literal("true");
+				integer = 1;
+			}
+			else if (c == 'f')
+				literal("false");
+			else
+				isInt = parseNumber(integer, isUnsigned, real);
+
+			if (n.type == Node::Type::IntArray)
+			{
+				// Negative values and values beyond the signed range cannot share integer storage
+				const bool mixedSign = isUnsigned ? (!n.isUnsigned && std::any_of(n.integers.begin(), n.integers.end(), [](int64_t v) { return v < 0; }))
+					: (n.isUnsigned && (integer < 0));
+
+				if (isInt && !mixedSign)
+				{
+					n.isUnsigned = n.isUnsigned || isUnsigned;
+					n.integers.push_back(integer);
+					return;
+				}
+
+				// Switch to floating point storage
+				n.type = Node::Type::DoubleArray;
+				n.reals.reserve(std::max<std::size_t>(n.integers.capacity(), 16));
+				for (int64_t v : n.integers)
+					n.reals.push_back(n.isUnsigned ? static_cast<double>(static_cast<uint64_t>(v)) : static_cast<double>(v));
+				n.integers = std::vector<int64_t>();
+				n.isUnsigned = false;
+			}
+
+			if (isInt)
+				real = isUnsigned ? static_cast<double>(static_cast<uint64_t>(integer)) : static_cast<double>(integer);
+			n.reals.push_back(real);
+		}
+
+		void convertToGenericArray(Node& n)
+		{
+			n.children.reserve(n.integers.size() + n.reals.size() + 1);
+			for (int64_t v : n.integers)
+			{
+				n.children.emplace_back();
+				n.children.back().type = Node::Type::Int;
+				n.children.back().integer = v;
+				n.children.back().isUnsigned = n.isUnsigned;
+			}
+			for (double v : n.reals)
+			{
+				n.children.emplace_back();
+				n.children.back().type = Node::Type::Double;
+				n.children.back().real = v;
+			}
+
+			n.type = Node::Type::Array;
+			n.integers = std::vector<int64_t>();
+			n.reals = std::vector<double>();
+		}
+
+		/**
+		 * @brief Parses a number
+		 * @param [out] integer Value if the number is integral
+		 * @param [out] isUnsigned Determines whether the integral number exceeds the signed range
+		 * @param [out] real Value if the number is not integral
+		 * @return @c true if the number is integral, otherwise @c false
+		 */
+		bool parseNumber(int64_t& integer, bool& isUnsigned, double& real)
+		{
+			const char* const start = _pos;
+			const bool negative = (peek() == '-');
+			if (negative)
+				++_pos;
+
+			if (!isDigit(peek()))
+				error("Invalid number");
+
+			const uint64_t maxMantissa = std::numeric_limits<uint64_t>::max();
+			uint64_t mantissa = 0;
+			int exponent = 0;
+			bool truncated = false;
+			bool isInt = true;
+
+			// Integer part
+			if (*_pos == '0')
+				++_pos;
+			else
+			{
+				while ((_pos < _end) && isDigit(*_pos))
+				{
+					const uint64_t d = static_cast<uint64_t>(*_pos - '0');
+					if (mantissa <= (maxMantissa - d) / 10)
+						mantissa = mantissa * 10 + d;
+					else
+					{
+						truncated = true;
+						++exponent;
+					}
+					++_pos;
+				}
+			}
+
+			// Fractional part
+			if (peek() == '.')
+			{
+				isInt = false;
+				++_pos;
+				if (!isDigit(peek()))
+					error("Invalid number");
+
+				while ((_pos < _end) && isDigit(*_pos))
+				{
+					const uint64_t d = static_cast<uint64_t>(*_pos - '0');
+					if ((mantissa == 0) && (d == 0))
+						--exponent;
+					else if (mantissa <= (maxMantissa - d) / 10)
+					{
+						mantissa = mantissa * 10 + d;
+						--exponent;
+					}
+					else
+						truncated = true;
+					++_pos;
+				}
+			}
+
+			// Exponent
+			if ((peek() == 'e') || (peek() == 'E'))
+			{
+				isInt = false;
+				++_pos;
+
+				bool negExp = false;
+				if ((peek() == '+') || (peek() == '-'))
+				{
+					negExp = (*_pos == '-');
+					++_pos;
+				}
+
+				if (!isDigit(peek()))
+					error("Invalid number");
+
+				int e = 0;
+				while ((_pos < _end) && isDigit(*_pos))
+				{
+					if (e < 100000)
+						e = e * 10 + (*_pos - '0');
+					++_pos;
+				}
+				exponent += negExp ? -e : e;
+			}
+
+			if (isInt && !truncated)
+			{
+				if (!negative)
+				{
+					integer = static_cast<int64_t>(mantissa);
+					isUnsigned = (mantissa > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()));
+					return true;
+				}
+				if (mantissa <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+				{
+					integer = -static_cast<int64_t>(mantissa);
+					return true;
+				}
+			}
+
+			if (!truncated && (mantissa <= (uint64_t(1) << 53)) && (exponent >= -22) && (exponent <= 22))
+			{
+				// Both mantissa and power of ten are exact, so a single operation is correctly rounded
+				real = static_cast<double>(mantissa);
+				if (exponent < 0)
+					real /= powersOfTen[-exponent];
+				else
+					real *= powersOfTen[exponent];
+
+				if (negative)
+					real = -real;
+			}
+			else
+				real = std::strtod(std::string(start, _pos).c_str(), nullptr);
+
+			return false;
+		}
+
+		void parseString(std::string& str)
+		{
+			++_pos;
+			while (true)
+			{
+				// Copy chunk up to next quote or escape sequence
+				const char* const chunk = _pos;
+				while ((_pos < _end) && (*_pos != '"') && (*_pos != '\\'))
+				{
+					if (static_cast<unsigned char>(*_pos) < 0x20)
+						error("Invalid control character in string");
+					++_pos;
+				}
+				str.append(chunk, _pos);
+
+				if (_pos >= _end)
+					error("Unterminated string");
+
+				if (*_pos == '"')
+				{
+					++_pos;
+					return;
+				}
+
+				// Escape sequence
+				++_pos;
+				switch (peek())
+				{
+					case '"': str.push_back('"'); break;
+					case '\\': str.push_back('\\'); break;
+					case '/': str.push_back('/'); break;
+					case 'b': str.push_back('\b'); break;
+					case 'f': str.push_back('\f'); break;
+					case 'n': str.push_back('\n'); break;
+					case 'r': str.push_back('\r'); break;
+					case 't': str.push_back('\t'); break;
+					case 'u':
+					{
+						++_pos;
+						uint32_t cp = parseHex4();
+						if ((cp >= 0xD800) && (cp <= 0xDBFF))
+						{
+							// Surrogate pair
+							if ((peek() != '\\') || (_pos + 1 >= _end) || (_pos[1] != 'u'))
+								error("Invalid surrogate pair");
+							_pos += 2;
+							const uint32_t low = parseHex4();
+							if ((low < 0xDC00) || (low > 0xDFFF))
+								error("Invalid surrogate pair");
+							cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+						}
+						appendUtf8(str, cp);
+						continue;
+					}
+					default:
+						error("Invalid escape sequence");
+				}
+				++_pos;
+			}
+		}
+
+		inline uint32_t parseHex4()
+		{
+			uint32_t cp = 0;
+			for (int i = 0; i < 4; ++i, ++_pos)
+			{
+				const char c = peek();
+				cp <<= 4;
+				if (isDigit(c))
+					cp += c - '0';
+				else if ((c >= 'a') && (c <= 'f'))
+					cp += c - 'a' + 10;
+				else if ((c >= 'A') && (c <= 'F'))
+					cp += c - 'A' + 10;
+				else
+					error("Invalid unicode escape sequence");
+			}
+			return cp;
+		}
+
+		static inline void appendUtf8(std::string& str, uint32_t cp)
+		{
+			if (cp < 0x80)
+				str.push_back(static_cast<char>(cp));
+			else if (cp < 0x800)
+			{
+				str.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+				str.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+			}
+			else if (cp < 0x10000)
+			{
+				str.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+				str.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+				str.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+			}
+			else
+			{
+				str.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+				str.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+				str.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+				str.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+			}
+		}
+
+		/**
+		 * @brief Sorts the members of an object by key for binary search
+		 * @details If a key occurs more than once, the last occurrence is kept.
+		 */
+		static void sortMembers(Node& n)
+		{
+			if (std::is_sorted(n.keys.begin(), n.keys.end()) && (std::adjacent_find(n.keys.begin(), n.keys.end()) == n.keys.end()))
+				return;
+
+			std::vector<std::size_t> perm(n.keys.size());
+			std::iota(perm.begin(), perm.end(), 0);
+			std::stable_sort(perm.begin(), perm.end(), [&](std::size_t a, std::size_t b) { return n.keys[a] < n.keys[b]; });
+
+			std::vector<std::string> keys;
+			std::vector<Node> children;
+			keys.reserve(perm.size());
+			children.reserve(perm.size());
+			for (std::size_t i = 0; i < perm.size(); ++i)
+			{
+				// Skip all but the last occurrence of a key
+				if ((i + 1 < perm.size()) && (n.keys[perm[i]] == n.keys[perm[i + 1]]))
+					continue;
+
+				keys.push_back(std::move(n.keys[perm[i]]));
+				children.push_back(std::move(n.children[perm[i]]));
+			}
+
+			n.keys = std::move(keys);
+			n.children = std::move(children);
+		}
+	};
+
+	[[noreturn]] void typeError(const std::string& paramName, const char* type)
+	{
+		throw cadet::io::IOException("Field \"" + paramName + "\" cannot be converted to " + type);
+	}
+
+	inline double toDouble(int64_t v, bool isUnsigned) CADET_NOEXCEPT
+	{
+		return isUnsigned ? static_cast<double>(static_cast<uint64_t>(v)) : static_cast<double>(v);
+	}
+
+	double asDouble(const Node& n, const std::string& paramName)
+	{
+		switch (n.type)
+		{
+			case Node::Type::Bool:
+			case Node::Type::Int:
+				return toDouble(n.integer, n.isUnsigned);
+			case Node::Type::Double:
+				return n.real;
+			case Node::Type::IntArray:
+				if (n.integers.size() == 1)
+					return toDouble(n.integers[0], n.isUnsigned);
+				break;
+			case Node::Type::DoubleArray:
+				if (n.reals.size() == 1)
+					return n.reals[0];
+				break;
+			case Node::Type::Array:
+				if (n.children.size() == 1)
+					return asDouble(n.children[0], paramName);
+				break;
+			default:
+				break;
+		}
+		typeError(paramName, "double");
+	}
+
+	int64_t asInteger(const Node& n, const std::string& paramName)
+	{
+		switch (n.type)
+		{
+			case Node::Type::Bool:
+			case Node::Type::Int:
+				return n.integer;
+			case Node::Type::Double:
+				return static_cast<int64_t>(n.real);
+			case Node::Type::IntArray:
+				if (n.integers.size() == 1)
+					return n.integers[0];
+				break;
+			case Node::Type::DoubleArray:
+				if (n.reals.size() == 1)
+					return static_cast<int64_t>(n.reals[0]);
+				break;
+			case Node::Type::Array:
+				if (n.children.size() == 1)
+					return asInteger(n.children[0], paramName);
+				break;
+			default:
+				break;
+		}
+		typeError(paramName, "integer");
+	}
+
+	const std::string& asString(const Node& n, const std::string& paramName)
+	{
+		if (n.type == Node::Type::String)
+			return n.string;
+		if ((n.type == Node::Type::Array) && (n.children.size() == 1))
+			return asString(n.children[0], paramName);
+		typeError(paramName, "string");
+	}
+
+	/**
+	 * @brief Converts a node to a vector of integral values
+	 * @param [in] n Node
+	 * @param [in] paramName Name of the parameter used in error messages
+	 * @param [in] type Name of the type used in error messages
+	 * @tparam T Integral type of the vector elements
+	 */
+	template <typename T>
+	std::vector<T> asIntegerArray(const Node& n, const std::string& paramName, const char* type)
+	{
+		switch (n.type)
+		{
+			case Node::Type::IntArray:
+				return std::vector<T>(n.integers.begin(), n.integers.end());
+			case Node::Type::DoubleArray:
+			{
+				std::vector<T> v(n.reals.size());
+				for (std::size_t i = 0; i < n.reals.size(); ++i)
+					v[i] = static_cast<T>(static_cast<int64_t>(n.reals[i]));
+				return v;
+			}
+			case Node::Type::Array:
+			{
+				std::vector<T> v(n.children.size());
+				for (std::size_t i = 0; i < n.children.size(); ++i)
+					v[i] = static_cast<T>(asInteger(n.children[i], paramName));
+				return v;
+			}
+			case Node::Type::Bool:
+			case Node::Type::Int:
+			case Node::Type::Double:
+				return std::vector<T>(1, static_cast<T>(asInteger(n, paramName)));
+			default:
+				break;
+		}
+		typeError(paramName, type);
+	}
+}
+
+namespace cadet
+{
+
+std::size_t CompactJsonParameterProvider::Node::size() const CADET_NOEXCEPT
+{
+	switch (type)
+	{
+		case Type::Null:
+			return 0;
+		case Type::Object:
+			return keys.size();
+		case Type::Array:
+			return children.size();
+		case Type::IntArray:
+			return integers.size();
+		case Type::DoubleArray:
+			return reals.size();
+		default:
+			return 1;
+	}
+}
+
+CompactJsonParameterProvider::Node const* CompactJsonParameterProvider::Node::find(const std::string& key) const
+{
+	const std::vector<std::string>::const_iterator it = std::lower_bound(keys.begin(), keys.end(), key);
+	if ((it == keys.end()) || (*it != key))
+		return nullptr;
+
+	return &children[it - keys.begin()];
+}
+
+CompactJsonParameterProvider::CompactJsonParameterProvider() : _scopePath("/")
+{
+	_opened.push(&_root);
+}
+
+CompactJsonParameterProvider::CompactJsonParameterProvider(const char* data) : CompactJsonParameterProvider()
+{
+	parse(data, std::strlen(data));
+}
+
+CompactJsonParameterProvider::CompactJsonParameterProvider(const std::string& data) : CompactJsonParameterProvider()
+{
+	parse(data.c_str(), data.size());
+}
+
+CompactJsonParameterProvider::CompactJsonParameterProvider(CompactJsonParameterProvider&& cpy) CADET_NOEXCEPT : _root(std::move(cpy._root)), _scopePath("/")
+{
+	// Scopes point into the moved tree, so start at the root
+	_opened.push(&_root);
+}
+
+CompactJsonParameterProvider::~CompactJsonParameterProvider() CADET_NOEXCEPT
+{
+}
+
+CompactJsonParameterProvider& CompactJsonParameterProvider::operator=(CompactJsonParameterProvider&& cpy) CADET_NOEXCEPT
+{
+	_root = std::move(cpy._root);
+	_opened = std::stack<Node const*>();
+	_opened.push(&_root);
+	_scopePath = "/";
+
+	return *this;
+}
+
+void CompactJsonParameterProvider::parse(const char* data, std::size_t len)
+{
+	Parser p(data, len);
+	p.parseDocument(_root);
+}
+
+const CompactJsonParameterProvider::Node& CompactJsonParameterProvider::at(const std::string& paramName) const
+{
+	Node const* const n = _opened.top()->find(paramName);
+	if (!n)
+		throw io::IOException("Field \"" + paramName + "\" does not exist in scope " + _scopePath);
+
+	return *n;
+}
+
+double CompactJsonParameterProvider::getDouble(const std::string& paramName)
+{
+	return asDouble(at(paramName), paramName);
+}
+
+int CompactJsonParameterProvider::getInt(const std::string& paramName)
+{
+	return static_cast<int>(asInteger(at(paramName), paramName));
+}
+
+uint64_t CompactJsonParameterProvider::getUint64(const std::string& paramName)
+{
+	return static_cast<uint64_t>(asInteger(at(paramName), paramName));
+}
+
+bool CompactJsonParameterProvider::getBool(const std::string& paramName)
+{
+	return asInteger(at(paramName), paramName) != 0;
+}
+
+std::string CompactJsonParameterProvider::getString(const std::string& paramName)
+{
+	return asString(at(paramName), paramName);
+}
+
+std::vector<double> CompactJsonParameterProvider::getDoubleArray(const std::string& paramName)
+{
+	const Node& n = at(paramName);
+	switch (n.type)
+	{
+		case Node::Type::DoubleArray:
+			return n.reals;
+		case Node::Type::IntArray:
+		{
+			std::vector<double> v(n.integers.size());
+			for (std::size_t i = 0; i < n.integers.size(); ++i)
+				v[i] = toDouble(n.integers[i], n.isUnsigned);
+			return v;
+		}
+		case Node::Type::Array:
+		{
+			std::vector<double> v(n.children.size());
+			for (std::size_t i = 0; i < n.children.size(); ++i)
+				v[i] = asDouble(n.children[i], paramName);
+			return v;
+		}
+		default:
+			return std::vector<double>(1, asDouble(n, paramName));
+	}
+}
+
+std::vector<int> CompactJsonParameterProvider::getIntArray(const std::string& paramName)
+{
+	return asIntegerArray<int>(at(paramName), paramName, "integer array");
+}
+
+std::vector<uint64_t> CompactJsonParameterProvider::getUint64Array(const std::string& paramName)
+{
+	return asIntegerArray<uint64_t>(at(paramName), paramName, "uint64 array");
+}
+
+std::vector<bool> CompactJsonParameterProvider::getBoolArray(const std::string& paramName)
+{
+	const std::vector<int64_t> v = asIntegerArray<int64_t>(at(paramName), paramName, "bool array");
+	std::vector<bool> bv(v.size());
+	for (std::size_t i = 0; i < v.size(); ++i)
+		bv[i] = (v[i] != 0);
+	return bv;
+}
+
+std::vector<std::string> CompactJsonParameterProvider::getStringArray(const std::string& paramName)
+{
+	const Node& n = at(paramName);
+	if (n.type == Node::Type::String)
+		return std::vector<std::string>(1, n.string);
+
+	if (n.type != Node::Type::Array)
+		typeError(paramName, "string array");
+
+	std::vector<std::string> v;
+	v.reserve(n.children.size());
+	for (const Node& c : n.children)
+		v.push_back(asString(c, paramName));
+	return v;
+}
+
+bool CompactJsonParameterProvider::exists(const std::string& paramName)
+{
+	return _opened.top()->find(paramName) != nullptr;
+}
+
+bool CompactJsonParameterProvider::isArray(const std::string& paramName)
+{
+	const Node::Type t = at(paramName).type;
+	return (t == Node::Type::Array) || (t == Node::Type::IntArray) || (t == Node::Type::DoubleArray);
+}
+
+std::size_t CompactJsonParameterProvider::numElements(const std::string& paramName)
+{
+	return at(paramName).size();
+}
+
+void CompactJsonParameterProvider::pushScope(const std::string& scope)
+{
+	const Node& n = at(scope);
+	if (n.type != Node::Type::Object)
+		throw io::IOException("Field \"" + scope + "\" in scope " + _scopePath + " is not a group");
+
+	_opened.push(&n);
+
+	if (_scopePath.back() != '/')
+		_scopePath += "/";
+	_scopePath += scope;
+}
+
+void CompactJsonParameterProvider::popScope()
+{
+	_opened.pop();
+
+	const std::size_t idx = _scopePath.find_last_of('/');
+	_scopePath.erase(std::max<std::size_t>(idx, 1));
+}
+
+CompactJsonParameterProvider CompactJsonParameterProvider::fromFile(const std::string& fileName)
+{
+	std::ifstream ifs(fileName, std::ios::in | std::ios::binary);
+	if (!ifs.good())
+		throw io::IOException("Could not open file " + fileName);
+
+	// Read whole file at once
+	ifs.seekg(0, std::ios::end);
+	const std::streamoff len = ifs.tellg();
+	ifs.seekg(0, std::ios::beg);
+
+	std::string data(static_cast<std::size_t>(len), '\0');
+	ifs.read(&data[0], len);
+
+	CompactJsonParameterProvider jpp;
+	jpp.parse(data.c_str(), data.size());
+	return jpp;
+}
+
+} // namespace cadet
@@ -0,0 +1,104 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include "AllocationTracker.hpp"
+
+#ifdef CADET_ALLOCATION_TRACKING
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	// Allocations of other threads (e.g., asynchronous logging) must not be attributed to the measured scope
+	thread_local std::uint64_t numAllocations = 0;
+
+	inline void* countedAllocate(std::size_t size)
+	{
+		++numAllocations;
+		return std::malloc(size == 0 ? 1 : size);
+	}
+}
+
+namespace cadet
+{
+
+namespace util
+{
+	std::uint64_t numHeapAllocations() CADET_NOEXCEPT
+	{
+		return numAllocations;
+	}
+
+} // namespace util
+
+} // namespace cadet
+
+// Replace global allocation and deallocation functions
+
+void* operator new(std::size_t size)
+{
+	void* const ptr = countedAllocate(size);
+	if (!ptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+	void* const ptr = countedAllocate(size);
+	if (!ptr)
+		throw std::bad_alloc();
+	return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	return countedAllocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	return countedAllocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+#endif
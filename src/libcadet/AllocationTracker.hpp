@@ -0,0 +1,114 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file 
+ * Provides heap allocation tracking for detecting allocations in hot paths.
+ */
+
+#ifndef LIBCADET_ALLOCATIONTRACKER_HPP_
+#define LIBCADET_ALLOCATIONTRACKER_HPP_
+
+#ifdef CADET_ALLOCATION_TRACKING
+
+	#include "cadet/cadetCompilerInfo.hpp"
+
+	#include <cstdint>
+	#include <algorithm>
+
+	namespace cadet
+	{
+
+	namespace util
+	{
+		/**
+		 * @brief Returns the number of heap allocations performed so far by the calling thread
+		 * @details Counts the calls to the global (replaced) operator new of the calling thread.
+		 *          Allocations of worker threads in parallelized regions (see CADET_PARALLELIZE)
+		 *          are not included.
+		 * @return Number of heap allocations of the calling thread since its start
+		 */
+		std::uint64_t numHeapAllocations() CADET_NOEXCEPT;
+
+		/**
+		 * @brief Counts heap allocations performed by the calling thread since its construction
+		 */
+		class AllocationCounter
+		{
+		public:
+			AllocationCounter() CADET_NOEXCEPT : _start(numHeapAllocations()) { }
+
+			/**
+			 * @brief Returns the number of heap allocations since construction
+			 * @return Number of heap allocations
+			 */
+			inline std::uint64_t count() const CADET_NOEXCEPT { return numHeapAllocations() - _start; }
+
+		private:
+			std::uint64_t _start; //!< Number of heap allocations on construction
+		};
+
+		/**
+		 * @brief Accumulates heap allocations of repeated calls to a function
+		 */
+		struct AllocationStatistics
+		{
+			std::uint64_t calls; //!< Number of calls
+			std::uint64_t allocations; //!< Total number of heap allocations in all calls
+			std::uint64_t maxAllocations; //!< Maximum number of heap allocations in a single call
+
+			AllocationStatistics() CADET_NOEXCEPT : calls(0), allocations(0), maxAllocations(0) { }
+
+			inline void reset() CADET_NOEXCEPT
+			{
+				calls = 0;
+				allocations = 0;
+				maxAllocations = 0;
+			}
+
+			inline void record(std::uint64_t n) CADET_NOEXCEPT
+			{
+				++calls;
+				allocations += n;
+				maxAllocations = std::max(maxAllocations, n);
+			}
+		};
+
+		/**
+		 * @brief Records the heap allocations in the enclosing scope on destruction
+		 */
+		class AllocationScope
+		{
+		public:
+			AllocationScope(AllocationStatistics& stats) CADET_NOEXCEPT : _stats(stats), _counter() { }
+			~AllocationScope() CADET_NOEXCEPT { _stats.record(_counter.count()); }
+
+		private:
+			AllocationStatistics& _stats;
+			AllocationCounter _counter;
+		};
+
+	} // namespace util
+
+	} // namespace cadet
+
+	#define ALLOCATION_STATS(name) ::cadet::util::AllocationStatistics name;
+	#define ALLOCATION_SCOPE(stats) ::cadet::util::AllocationScope allocationScope(stats)
+
+#else
+
+	#define ALLOCATION_STATS(name)
+	#define ALLOCATION_SCOPE(stats)
+
+#endif
+
+#endif  // LIBCADET_ALLOCATIONTRACKER_HPP_
@@ -0,0 +1,343 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file 
+ * Provides a background writer for log messages.
+ */
+
+#ifndef LIBCADET_ASYNCLOGWRITER_HPP_
+#define LIBCADET_ASYNCLOGWRITER_HPP_
+
+#include "Logging.hpp"
+
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <cstring>
+
+namespace cadet
+{
+namespace log
+{
+
+	/**
+	 * @brief Bounded lock-free queue of log records with multiple producers and a single consumer
+	 * @details The queue is based on Dmitry Vyukov's bounded MPMC queue. Each slot carries a sequence
+	 *          number that tells producers and the consumer whether the slot is free or holds a record.
+	 *          Producers never block and push fails if the queue is full. Message buffers are swapped
+	 *          between producers, slots, and the consumer, so their memory is reused once the queue is warm.
+	 */
+	class LogRecordQueue
+	{
+	public:
+		/**
+		 * @brief Creates a queue
+		 * @param [in] capacity Minimum number of records the queue can hold (rounded up to a power of two)
+		 */
+		LogRecordQueue(std::size_t capacity) : _capacity(roundUpToPowerOfTwo(capacity)), _slots(new Slot[_capacity]),
+			_enqueuePos(0), _dequeuePos(0)
+		{
+			for (std::size_t i = 0; i < _capacity; ++i)
+				_slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		/**
+		 * @brief Appends a record to the queue
+		 * @param [in] file Filename in which the log message was raised
+		 * @param [in] func Name of the function in which the log message was raised
+		 * @param [in] line Line in which the log message was raised
+		 * @param [in] lvl Log level of the message
+		 * @param [in] message Formatted message
+		 * @return @c true if the record has been queued, @c false if the queue is full
+		 */
+		inline bool tryPush(const char* file, const char* func, unsigned int line, LogLevel lvl, const char* message)
+		{
+			Slot* const slot = acquireSlot();
+			if (!slot)
+				return false;
+
+			slot->record.file = file;
+			slot->record.func = func;
+			slot->record.line = line;
+			slot->record.lvl = lvl;
+			slot->record.message.assign(message);
+			slot->record.values.clear();
+			slot->record.arrays.clear();
+
+			publishSlot(*slot);
+			return true;
+		}
+
+		/**
+		 * @brief Appends a record to the queue by swapping its buffers into the queue
+		 * @details If the record has been queued, @p rec receives the buffers of a previously
+		 *          consumed record and its content is unspecified.
+		 * @param [in,out] rec Record
+		 * @return @c true if the record has been queued, @c false if the queue is full
+		 */
+		inline bool tryPush(LogRecord& rec)
+		{
+			Slot* const slot = acquireSlot();
+			if (!slot)
+				return false;
+
+			slot->record.file = rec.file;
+			slot->record.func = rec.func;
+			slot->record.line = rec.line;
+			slot->record.lvl = rec.lvl;
+			slot->record.message.swap(rec.message);
+			slot->record.values.swap(rec.values);
+			slot->record.arrays.swap(rec.arrays);
+
+			publishSlot(*slot);
+			return true;
+		}
+
+		/**
+		 * @brief Removes the oldest record from the queue
+		 * @details Must only be called by a single consumer thread.
+		 * @param [out] rec Record
+		 * @return @c true if a record has been removed, @c false if the queue is empty
+		 */
+		inline bool tryPop(LogRecord& rec)
+		{
+			Slot& slot = _slots[_dequeuePos & (_capacity - 1)];
+			const std::size_t seq = slot.sequence.load(std::memory_order_acquire);
+			if (static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(_dequeuePos + 1) < 0)
+				return false;
+
+			rec.file = slot.record.file;
+			rec.func = slot.record.func;
+			rec.line = slot.record.line;
+			rec.lvl = slot.record.lvl;
+			rec.message.swap(slot.record.message);
+			rec.values.swap(slot.record.values);
+			rec.arrays.swap(slot.record.arrays);
+
+			slot.sequence.store(_dequeuePos + _capacity, std::memory_order_release);
+			++_dequeuePos;
+			return true;
+		}
+
+		inline std::size_t capacity() const CADET_NOEXCEPT { return _capacity; }
+
+	private:
+
+		struct Slot
+		{
+			std::atomic<std::size_t> sequence;
+			LogRecord record;
+			std::size_t position; //!< Enqueue position the slot has been acquired for
+		};
+
+		/**
+		 * @brief Reserves the slot at the current enqueue position
+		 * @return Slot or @c nullptr if the queue is full
+		 */
+		inline Slot* acquireSlot()
+		{
+			std::size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+			while (true)
+			{
+				Slot* const slot = &_slots[pos & (_capacity - 1)];
+				const std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+				const std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+				if (diff == 0)
+				{
+					if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					{
+						slot->position = pos;
+						return slot;
+					}
+				}
+				else if (diff < 0)
+					return nullptr;
+				else
+					pos = _enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		/**
+		 * @brief Hands a filled slot over to the consumer
+		 * @param [in] slot Slot returned by acquireSlot()
+		 */
+		static inline void publishSlot(Slot& slot)
+		{
+			slot.sequence.store(slot.position + 1, std::memory_order_release);
+		}
+
+		static inline std::size_t roundUpToPowerOfTwo(std::size_t n) CADET_NOEXCEPT
+		{
+			std::size_t p = 2;
+			while (p < n)
+				p <<= 1;
+			return p;
+		}
+
+		const std::size_t _capacity; //!< Number of slots (power of two)
+		std::unique_ptr<Slot[]> _slots; //!< Slots of the ring buffer
+		alignas(64) std::atomic<std::size_t> _enqueuePos; //!< Position of the next push
+		alignas(64) std::size_t _dequeuePos; //!< Position of the next pop (only accessed by consumer)
+	};
+
+	/**
+	 * @brief Delivers queued log records to a sink on a background thread
+	 * @details Records are pushed into a bounded LogRecordQueue by the emitting threads. Deferred
+	 *          arrays are formatted on the background thread before the record is handed to the sink.
+	 *          If the queue is full, the record is dropped and counted. The background thread reports
+	 *          the number of dropped records as a warning once the queue has space again.
+	 * @tparam Sink_t Callable with signature <tt>void(const LogRecord&)</tt>
+	 */
+	template <class Sink_t>
+	class AsyncLogWriter
+	{
+	public:
+		/**
+		 * @brief Creates the writer and starts the background thread
+		 * @param [in] capacity Maximum number of queued records
+		 * @param [in] sink Sink that receives all records
+		 */
+		AsyncLogWriter(std::size_t capacity, Sink_t sink) : _queue(capacity), _sink(sink), _running(true), _numPushed(0),
+			_numProcessed(0), _numDropped(0), _totalDropped(0), _thread(&AsyncLogWriter::run, this) { }
+
+		/**
+		 * @brief Delivers all queued records and stops the background thread
+		 */
+		~AsyncLogWriter() CADET_NOEXCEPT
+		{
+			_running.store(false, std::memory_order_release);
+			_thread.join();
+		}
+
+		/**
+		 * @brief Queues a record
+		 * @return @c true if the record has been queued, @c false if it was dropped
+		 */
+		inline bool push(const char* file, const char* func, unsigned int line, LogLevel lvl, const char* message)
+		{
+			if (_queue.tryPush(file, func, line, lvl, message))
+			{
+				_numPushed.fetch_add(1, std::memory_order_release);
+				return true;
+			}
+
+			_numDropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		/**
+		 * @brief Queues a record by swapping its buffers into the queue
+		 * @details The content of @p rec is unspecified afterwards, but its memory can be reused.
+		 * @param [in,out] rec Record
+		 * @return @c true if the record has been queued, @c false if it was dropped
+		 */
+		inline bool push(LogRecord& rec)
+		{
+			if (_queue.tryPush(rec))
+			{
+				_numPushed.fetch_add(1, std::memory_order_release);
+				return true;
+			}
+
+			_numDropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		/**
+		 * @brief Waits until all records queued so far are delivered to the sink
+		 */
+		inline void flush() const
+		{
+			const std::uint64_t target = _numPushed.load(std::memory_order_acquire);
+			while (_numProcessed.load(std::memory_order_acquire) < target)
+				std::this_thread::yield();
+		}
+
+		/**
+		 * @brief Returns the total number of dropped records
+		 */
+		inline std::uint64_t numDropped() const CADET_NOEXCEPT { return _totalDropped.load(std::memory_order_relaxed); }
+
+		inline std::size_t capacity() const CADET_NOEXCEPT { return _queue.capacity(); }
+
+	private:
+
+		LogRecordQueue _queue;
+		Sink_t _sink;
+		std::atomic<bool> _running;
+		std::atomic<std::uint64_t> _numPushed; //!< Number of queued records
+		std::atomic<std::uint64_t> _numProcessed; //!< Number of delivered records
+		std::atomic<std::uint64_t> _numDropped; //!< Number of dropped records that have not been reported yet
+		std::atomic<std::uint64_t> _totalDropped; //!< Total number of dropped records
+		std::thread _thread;
+
+		void run()
+		{
+			LogRecord rec;
+			unsigned int idle = 0;
+			while (true)
+			{
+				if (_queue.tryPop(rec))
+				{
+					formatDeferredArrays(rec);
+					_sink(rec);
+					_numProcessed.fetch_add(1, std::memory_order_release);
+					idle = 0;
+					continue;
+				}
+
+				reportDropped();
+
+				if (!_running.load(std::memory_order_acquire))
+				{
+					// Deliver records that have been queued before stopping
+					if (_numProcessed.load(std::memory_order_acquire) >= _numPushed.load(std::memory_order_acquire))
+						break;
+					continue;
+				}
+
+				// Back off while the queue is empty
+				++idle;
+				if (idle < 64)
+					std::this_thread::yield();
+				else
+					std::this_thread::sleep_for(std::chrono::microseconds((idle < 1024) ? 50 : 1000));
+			}
+		}
+
+		void reportDropped()
+		{
+			const std::uint64_t dropped = _numDropped.exchange(0, std::memory_order_relaxed);
+			if (dropped == 0)
+				return;
+
+			_totalDropped.fetch_add(dropped, std::memory_order_relaxed);
+
+			LogRecord rec;
+			rec.file = __FILE__;
+			rec.func = __func__;
+			rec.line = __LINE__;
+			rec.lvl = LogLevel::Warning;
+			rec.message = "Dropped " + std::to_string(dropped) + " log messages because the log queue was full\n";
+			_sink(rec);
+		}
+	};
+
+} // namespace log
+} // namespace cadet
+
+#endif  // LIBCADET_ASYNCLOGWRITER_HPP_
@@ -22,6 +22,112 @@
 
 	#include "common/Timer.hpp"
 
+#ifdef CADET_PERF_COUNTERS
+
+	#include "common/PerfCounters.hpp"
+
+	/**
+	 * @brief Timer that also accumulates hardware performance counters
+	 * @details Provides the same interface as ::cadet::Timer. Only events of the thread that
+	 *          starts and stops the timer are counted. Use BENCH_COUNTER_SCOPE to collect
+	 *          the events of worker threads.
+	 */
+	class BenchmarkTimer : public ::cadet::Timer
+	{
+	public:
+
+		inline void start()
+		{
+			_begin = ::cadet::perf::takeSnapshot();
+			::cadet::Timer::start();
+		}
+
+		inline double stop()
+		{
+			const double elapsed = ::cadet::Timer::stop();
+			_counters.add(_begin);
+			return elapsed;
+		}
+
+		inline ::cadet::perf::CounterAccumulator& counters() { return _counters; }
+		inline const ::cadet::perf::CounterAccumulator& counters() const { return _counters; }
+
+	private:
+		::cadet::perf::Snapshot _begin; //!< Counter values at the last call to start()
+		::cadet::perf::CounterAccumulator _counters; //!< Accumulated counter values
+	};
+
+	#define BENCH_TIMER(name) mutable BenchmarkTimer name;
+	#define BENCH_START(name) name.start()
+	#define BENCH_STOP(name) name.stop()
+
+	/**
+	 * @brief Starts and stops a given timer on construction and desctruction, respectively
+	 * @details The counter values are taken on the thread that executes the scope.
+	 */
+	class BenchmarkScope
+	{
+	public:
+
+		BenchmarkScope(BenchmarkTimer& timer) : _timer(timer), _begin(::cadet::perf::takeSnapshot()) { _timer.::cadet::Timer::start(); }
+		~BenchmarkScope()
+		{
+			_timer.::cadet::Timer::stop();
+			_timer.counters().add(_begin);
+		}
+
+	private:
+		BenchmarkTimer& _timer;
+		::cadet::perf::Snapshot _begin;
+	};
+
+	/**
+	 * @brief Accumulates hardware performance counters of a region on the executing thread
+	 * @details Is safe to use inside parallel loops, since each scope takes its own snapshot
+	 *          and the accumulator sums up atomically. This allows collecting the counters
+	 *          of all worker threads in a parallel region. Each scope reads the counters twice,
+	 *          which costs several system calls. Hence, place the scope around the chunk of
+	 *          iterations a thread executes (e.g., the body of a tbb::blocked_range loop) and
+	 *          not inside a single iteration.
+	 */
+	class BenchmarkCounterScope
+	{
+	public:
+
+		BenchmarkCounterScope(::cadet::perf::CounterAccumulator& counters) : _counters(counters), _begin(::cadet::perf::takeSnapshot()) { }
+		~BenchmarkCounterScope() { _counters.add(_begin); }
+
+	private:
+		::cadet::perf::CounterAccumulator& _counters;
+		::cadet::perf::Snapshot _begin;
+	};
+
+	#define BENCH_COUNTER(name) mutable ::cadet::perf::CounterAccumulator name;
+	#define BENCH_COUNTER_SCOPE(name) BenchmarkCounterScope scope##name(name)
+
+	/**
+	 * @brief Accumulates the counters of a region in @p nameTrue if @p cond holds and in @p nameFalse otherwise
+	 * @details Enclose @p cond in parentheses if it contains commas.
+	 */
+	#define BENCH_COUNTER_SCOPE_SELECT(cond, nameTrue, nameFalse) BenchmarkCounterScope scope##nameTrue##nameFalse((cond) ? nameTrue : nameFalse)
+
+	static_assert(::cadet::perf::numEvents == 7, "BENCH_COUNTERS and BENCH_COUNTER_DESC have to list all events");
+
+	/**
+	 * @brief Appends the values of a counter accumulator to a list of benchmark timings
+	 * @details Unavailable counters are reported as @c -1.
+	 */
+	#define BENCH_COUNTERS(acc) , (acc).total(0), (acc).total(1), (acc).total(2), (acc).total(3), (acc).total(4), \
+		(acc).total(5), (acc).total(6)
+
+	/**
+	 * @brief Appends the descriptions of the counters to a list of benchmark descriptions
+	 */
+	#define BENCH_COUNTER_DESC(desc) , desc "Cycles", desc "Instructions", desc "CacheRefs", desc "CacheMisses", \
+		desc "L1dMisses", desc "FpScalar", desc "FpPacked"
+
+#else
+
 	#define BENCH_TIMER(name) mutable ::cadet::Timer name;
 	#define BENCH_START(name) name.start()
 	#define BENCH_STOP(name) name.stop()
@@ -40,6 +146,14 @@
 		::cadet::Timer& _timer;
 	};
 
+	#define BENCH_COUNTER(name)
+	#define BENCH_COUNTER_SCOPE(name)
+	#define BENCH_COUNTER_SCOPE_SELECT(cond, nameTrue, nameFalse)
+	#define BENCH_COUNTERS(acc)
+	#define BENCH_COUNTER_DESC(desc)
+
+#endif
+
 	#define BENCH_SCOPE(name) BenchmarkScope scope##name(name)
 
 #else
@@ -48,6 +162,11 @@
 	#define BENCH_START(name)
 	#define BENCH_STOP(name)
 	#define BENCH_SCOPE(name)
+	#define BENCH_COUNTER(name)
+	#define BENCH_COUNTER_SCOPE(name)
+	#define BENCH_COUNTER_SCOPE_SELECT(cond, nameTrue, nameFalse)
+	#define BENCH_COUNTERS(acc)
+	#define BENCH_COUNTER_DESC(desc)
 
 #endif
 
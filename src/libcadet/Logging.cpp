@@ -13,12 +13,35 @@
 #include "Logging.hpp"
 
 #ifndef CADET_LOGGING_DISABLE
+	#include "AsyncLogWriter.hpp"
+
+	#include <atomic>
+
 	namespace
 	{
 		/**
 		 * @brief Receiver of all log messages created in the libcadet library
+		 * @details Is read by the emitting threads and the background writer concurrently to setLogReceiver().
+		 */
+		std::atomic<cadet::ILogReceiver*> logReceiver(nullptr);
+
+		/**
+		 * @brief Forwards log records from the background thread to the log receiver
+		 */
+		struct ReceiverSink
+		{
+			inline void operator()(const cadet::log::LogRecord& rec) const
+			{
+				cadet::ILogReceiver* const recv = logReceiver.load(std::memory_order_acquire);
+				if (recv)
+					recv->message(rec.file, rec.func, rec.line, rec.lvl, cadet::to_string(rec.lvl), rec.message.c_str());
+			}
+		};
+
+		/**
+		 * @brief Background writer used if asynchronous logging is enabled, @c nullptr otherwise
 		 */
-		cadet::ILogReceiver* logReceiver = nullptr;
+		std::unique_ptr<cadet::log::AsyncLogWriter<ReceiverSink>> asyncWriter;
 	}
 
 	template <>
@@ -38,6 +61,8 @@ namespace cadet
 	void setLogReceiver(ILogReceiver* const recv) { }
 	void setLogLevel(LogLevel lvl) { }
 	LogLevel getLogLevel() { return LogLevel::None; }
+	void setAsyncLogging(bool enable, unsigned int capacity) { }
+	void flushLog() { }
 
 #else
 
@@ -45,14 +70,69 @@ namespace cadet
 	{
 		void emitLog(const char* file, const char* func, const unsigned int line, LogLevel lvl, const char* message)
 		{
-			if (logReceiver)
-				logReceiver->message(file, func, line, lvl, to_string(lvl), message);
+			if (asyncWriter)
+			{
+				asyncWriter->push(file, func, line, lvl, message);
+
+				// Make sure errors have reached the receiver before the caller reacts to them
+				if (lvl <= LogLevel::Error)
+					asyncWriter->flush();
+				return;
+			}
+
+			ILogReceiver* const recv = logReceiver.load(std::memory_order_acquire);
+			if (recv)
+				recv->message(file, func, line, lvl, to_string(lvl), message);
+		}
+
+		void emitLog(LogRecord& rec)
+		{
+			if (asyncWriter)
+			{
+				const LogLevel lvl = rec.lvl;
+				asyncWriter->push(rec);
+
+				// Make sure errors have reached the receiver before the caller reacts to them
+				if (lvl <= LogLevel::Error)
+					asyncWriter->flush();
+				return;
+			}
+
+			ILogReceiver* const recv = logReceiver.load(std::memory_order_acquire);
+			if (recv)
+			{
+				formatDeferredArrays(rec);
+				recv->message(rec.file, rec.func, rec.line, rec.lvl, to_string(rec.lvl), rec.message.c_str());
+			}
 		}
 	}
 
 	void setLogReceiver(ILogReceiver* const recv)
 	{
-		logReceiver = recv;
+		flushLog();
+		logReceiver.store(recv, std::memory_order_release);
+	}
+
+	void setAsyncLogging(bool enable, unsigned int capacity)
+	{
+		if (!enable)
+		{
+			// Destructor delivers all pending messages
+			asyncWriter.reset();
+			return;
+		}
+
+		if (asyncWriter && (asyncWriter->capacity() >= capacity))
+			return;
+
+		asyncWriter.reset();
+		asyncWriter.reset(new cadet::log::AsyncLogWriter<ReceiverSink>(capacity, ReceiverSink()));
+	}
+
+	void flushLog()
+	{
+		if (asyncWriter)
+			asyncWriter->flush();
 	}
 
 	void setLogLevel(LogLevel lvl)
@@ -85,4 +165,14 @@ extern "C"
 	{
 		return static_cast<typename std::underlying_type<cadet::LogLevel>::type>(cadet::getLogLevel());
 	}
+
+	void cadetSetAsyncLogging(int enable, unsigned int capacity)
+	{
+		cadet::setAsyncLogging(enable != 0, capacity);
+	}
+
+	void cadetFlushLog()
+	{
+		cadet::flushLog();
+	}
 }
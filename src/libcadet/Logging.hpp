@@ -21,11 +21,87 @@
 #include "cadet/Logging.hpp"
 #include "common/LoggerBase.hpp"
 
+#include <vector>
+#include <memory>
+#include <string>
+#include <sstream>
+#include <ostream>
+#include <type_traits>
+
 namespace cadet
 {
 namespace log
 {
 
+	template <class T> struct VectorPtr;
+
+	/**
+	 * @brief Array of numbers whose formatting is deferred to the thread that delivers the message
+	 */
+	struct DeferredArray
+	{
+		std::size_t position; //!< Offset in the message at which the formatted array is inserted
+		std::size_t first; //!< Index of the first element in LogRecord::values
+		std::size_t nElem; //!< Number of elements
+		std::streamsize precision; //!< Precision of the stream at the time the array was logged
+		std::ios_base::fmtflags flags; //!< Format flags of the stream at the time the array was logged
+		bool integral; //!< Determines whether the elements are integers
+	};
+
+	/**
+	 * @brief Log message with optional arrays that still have to be formatted
+	 */
+	struct LogRecord
+	{
+		const char* file; //!< Filename in which the log message was raised (string literal)
+		const char* func; //!< Name of the function in which the log message was raised (static string)
+		unsigned int line; //!< Line in which the log message was raised
+		LogLevel lvl; //!< Log level of the message
+		std::string message; //!< Formatted message without deferred arrays
+		std::vector<double> values; //!< Raw elements of all deferred arrays
+		std::vector<DeferredArray> arrays; //!< Deferred arrays ordered by their position in the message
+	};
+
+	/**
+	 * @brief Inserts the formatted deferred arrays into the message of a log record
+	 * @details Arrays are formatted like the output operator of VectorPtr does. Afterwards,
+	 *          the record does not contain deferred arrays anymore.
+	 * @param [in,out] rec Log record
+	 */
+	inline void formatDeferredArrays(LogRecord& rec)
+	{
+		if (rec.arrays.empty())
+			return;
+
+		std::ostringstream os;
+		std::size_t last = 0;
+		for (const DeferredArray& a : rec.arrays)
+		{
+			os.write(rec.message.data() + last, a.position - last);
+			last = a.position;
+
+			os.flags(a.flags);
+			os.precision(a.precision);
+			os << "[";
+			for (std::size_t i = 0; i < a.nElem; ++i)
+			{
+				if (i > 0)
+					os << ",";
+
+				if (a.integral)
+					os << static_cast<long long>(rec.values[a.first + i]);
+				else
+					os << rec.values[a.first + i];
+			}
+			os << "]";
+		}
+		os.write(rec.message.data() + last, rec.message.size() - last);
+
+		rec.message = os.str();
+		rec.values.clear();
+		rec.arrays.clear();
+	}
+
 	/**
 	 * @brief Dispatches a log message to a receiver
 	 * @param [in] file Filename in which the log message was raised
@@ -36,6 +112,15 @@ namespace log
 	 */
 	void emitLog(const char* file, const char* func, const unsigned int line, LogLevel lvl, const char* message);
 
+	/**
+	 * @brief Dispatches a log record to a receiver
+	 * @details The buffers of the record are swapped with the ones of the queue if asynchronous
+	 *          logging is enabled. Hence, the content of @p rec is unspecified after the call,
+	 *          but its memory can be reused for the next message.
+	 * @param [in,out] rec Log record
+	 */
+	void emitLog(LogRecord& rec);
+
 	/**
 	 * @brief Implements a standard formatting policy
 	 */
@@ -50,14 +135,152 @@ namespace log
 	};
 
 	/**
-	 * @brief Sends all messages to std::cout
+	 * @brief Stream buffer that appends to a string
+	 * @details In contrast to std::stringbuf, the string is not copied when the message is
+	 *          retrieved, but can be swapped with other strings.
 	 */
-	class EmitterWritePolicy : public NonBufferedWritePolicyBase<EmitterWritePolicy>
+	class StringAppendBuffer : public std::streambuf
 	{
 	public:
-		static inline void writeLine(const char* fileName, const char* funcName, unsigned int line, LogLevel lvl, const std::string& msg)
+		StringAppendBuffer(std::string& str) : _str(str) { }
+
+	protected:
+		virtual int_type overflow(int_type ch)
+		{
+			if (!traits_type::eq_int_type(ch, traits_type::eof()))
+				_str.push_back(traits_type::to_char_type(ch));
+			return traits_type::not_eof(ch);
+		}
+
+		virtual std::streamsize xsputn(const char* s, std::streamsize n)
+		{
+			_str.append(s, static_cast<std::size_t>(n));
+			return n;
+		}
+
+	private:
+		std::string& _str;
+	};
+
+	/**
+	 * @brief Thread local buffers for formatting log messages
+	 * @details Each thread formats its messages in its own records, whose memory is reused
+	 *          for subsequent messages. A stack of records handles log statements that are
+	 *          issued while another message is formatted (e.g., in an output operator).
+	 */
+	class ThreadLogBuffer
+	{
+	public:
+		struct Entry
+		{
+			Entry() : buffer(record.message), stream(&buffer) { }
+
+			LogRecord record; //!< Record that holds the formatted message
+			StringAppendBuffer buffer; //!< Stream buffer that appends to the message of the record
+			std::ostream stream; //!< Stream that formats the message
+		};
+
+		static inline void begin(const char* fileName, const char* funcName, unsigned int line, LogLevel lvl)
+		{
+			ThreadLogBuffer& buf = local();
+			if (buf._depth == buf._entries.size())
+				buf._entries.push_back(std::unique_ptr<Entry>(new Entry()));
+
+			LogRecord& rec = buf._entries[buf._depth]->record;
+			rec.file = fileName;
+			rec.func = funcName;
+			rec.line = line;
+			rec.lvl = lvl;
+			++buf._depth;
+		}
+
+		static inline Entry& top() { ThreadLogBuffer& buf = local(); return *buf._entries[buf._depth - 1]; }
+
+		static inline void end()
+		{
+			ThreadLogBuffer& buf = local();
+			--buf._depth;
+
+			// Keep memory but reset content and formatting
+			Entry& e = *buf._entries[buf._depth];
+			e.record.message.clear();
+			e.record.values.clear();
+			e.record.arrays.clear();
+
+			std::ostream& os = e.stream;
+			os.clear();
+			os.flags(std::ios_base::dec | std::ios_base::skipws);
+			os.precision(6);
+			os.width(0);
+			os.fill(' ');
+		}
+
+	private:
+		ThreadLogBuffer() : _depth(0) { }
+
+		static inline ThreadLogBuffer& local()
+		{
+			static thread_local ThreadLogBuffer buf;
+			return buf;
+		}
+
+		std::vector<std::unique_ptr<Entry>> _entries; //!< Entries are not moved since their streams refer to their records
+		std::size_t _depth;
+	};
+
+	/**
+	 * @brief Sends all messages to the log receiver
+	 * @details Messages are formatted in thread local buffers and handed over to emitLog() at once.
+	 *          Arrays of numbers (see VectorPtr) are copied and formatted by the thread that
+	 *          delivers the message.
+	 */
+	class EmitterWritePolicy : public BufferedWritePolicyBase<EmitterWritePolicy>
+	{
+	public:
+		static inline void begin(const char* fileName, const char* funcName, unsigned int line, LogLevel lvl)
+		{
+			ThreadLogBuffer::begin(fileName, funcName, line, lvl);
+		}
+
+		static inline void end(LogLevel lvl)
+		{
+			ThreadLogBuffer::Entry& e = ThreadLogBuffer::top();
+			e.stream << '\n';
+			emitLog(e.record);
+			ThreadLogBuffer::end();
+		}
+
+		template <class T>
+		static inline void writeObj(LogLevel lvl, const T& obj)
+		{
+			ThreadLogBuffer::top().stream << obj;
+		}
+
+		template <class T>
+		static inline void writeObj(LogLevel lvl, const VectorPtr<T>& obj)
+		{
+			writeArray(obj, std::integral_constant<bool, std::is_same<T, double>::value || (std::is_integral<T>::value && (sizeof(T) > 1) && (sizeof(T) <= 4))>());
+		}
+
+	private:
+
+		template <class T>
+		static inline void writeArray(const VectorPtr<T>& obj, std::false_type)
+		{
+			ThreadLogBuffer::top().stream << obj;
+		}
+
+		/**
+		 * @brief Copies the elements of an array to the record and leaves the formatting to formatDeferredArrays()
+		 * @details Only used for types that are exactly representable as @c double.
+		 */
+		template <class T>
+		static inline void writeArray(const VectorPtr<T>& obj, std::true_type)
 		{
-			emitLog(fileName, funcName, line, lvl, msg.c_str());
+			ThreadLogBuffer::Entry& e = ThreadLogBuffer::top();
+			LogRecord& rec = e.record;
+			rec.arrays.push_back(DeferredArray{rec.message.size(), rec.values.size(), obj.nElem, e.stream.precision(), e.stream.flags(), std::is_integral<T>::value});
+			rec.values.insert(rec.values.end(), obj.data, obj.data + obj.nElem);
 		}
 	};
 
@@ -36,6 +36,7 @@ struct AdJacobianParams;
 struct SimulationTime;
 struct SimulationState;
 struct ConstSimulationState;
+struct LinearSolverStatistics;
 
 /**
  * @brief Defines a model that can be simulated
@@ -468,6 +469,29 @@ public:
 	 */
 	virtual void setupParallelization(unsigned int numThreads) = 0;
 
+	/**
+	 * @brief Returns the index of an outlet component of a unit operation in the global state vector
+	 * @param [in] unitOpIdx Index of the unit operation
+	 * @param [in] port Index of the outlet port
+	 * @param [in] comp Index of the component
+	 * @return Index of the outlet component in the global state vector or @c -1 if it does not exist
+	 */
+	virtual int globalOutletIndex(UnitOpIdx unitOpIdx, unsigned int port, unsigned int comp) const = 0;
+
+	/**
+	 * @brief Returns the counters of the linear solver of a unit operation
+	 * @details The counters are accumulated over the lifetime of the unit operation.
+	 * @param [in] index Index of the unit operation in the model system (see IModelSystem::getModel())
+	 * @return Linear solver statistics of the unit operation
+	 */
+	virtual LinearSolverStatistics linearSolverStatistics(unsigned int index) const CADET_NOEXCEPT = 0;
+
+	/**
+	 * @brief Returns the accumulated number of GMRES iterations for solving the unit operation coupling
+	 * @return Number of GMRES iterations (matrix-vector products) of the coupling Schur-complement
+	 */
+	virtual int numCouplingGmresIterations() const CADET_NOEXCEPT = 0;
+
 protected:
 };
 
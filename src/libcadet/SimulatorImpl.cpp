@@ -14,10 +14,13 @@
 #include "cadet/SolutionRecorder.hpp"
 #include "cadet/ParameterProvider.hpp"
 #include "cadet/Notification.hpp"
+#include "cadet/EventHandler.hpp"
 #include "SimulatorImpl.hpp"
 #include "SimulatableModel.hpp"
 #include "ParamIdUtil.hpp"
 #include "SimulationTypes.hpp"
+#include "nonlin/AndersonAcceleration.hpp"
+#include "model/UnitOperation.hpp"
 
 #include <idas/idas.h>
 #include <idas/idas_impl.h>
@@ -25,8 +28,12 @@
 
 #include <vector>
 #include <sstream>
+#include <fstream>
 #include <algorithm>
 #include <cstdlib>
+#include <cstdio>
+#include <cstdint>
+#include <cmath>
 
 #include "AutoDiff.hpp"
 #include "LoggingUtils.hpp"
@@ -51,6 +58,21 @@ namespace
 		return sensState;
 	}
 
+	/**
+	 * @brief Extracts the data pointers of an array of NVectors into a given std::vector
+	 * @details Does not allocate memory if the capacity of @p ptrs is at least @p numVec.
+	 * @param [out] ptrs Vector that receives the data pointers
+	 * @param [in] vec Array of NVectors
+	 * @param [in] numVec Number of NVectors in the array
+	 */
+	template <class T>
+	inline void fillNVectorPtrs(std::vector<T>& ptrs, N_Vector* vec, unsigned int numVec)
+	{
+		ptrs.resize(numVec);
+		for (unsigned int i = 0; i < numVec; ++i)
+			ptrs[i] = NVEC_DATA(vec[i]);
+	}
+
 	const std::vector<double*> convertNVectorToStdVectorPtrs(unsigned int& len, N_Vector* vec, unsigned int numVec)
 	{
 		if (!vec || (numVec == 0))
@@ -73,6 +95,21 @@ namespace
 		return convertNVectorToStdVectorPtrs<const double*>(vec, numVec);
 	}
 
+	const char checkpointMagic[8] = {'C', 'A', 'D', 'E', 'T', 'C', 'K', 'P'}; //!< Identifies checkpoint files
+	const std::uint32_t checkpointVersion = 1; //!< Version of the checkpoint file format
+
+	template <typename T>
+	inline void writeBinary(std::ostream& os, const T& val)
+	{
+		os.write(reinterpret_cast<const char*>(&val), sizeof(T));
+	}
+
+	template <typename T>
+	inline void readBinary(std::istream& is, T& val)
+	{
+		is.read(reinterpret_cast<char*>(&val), sizeof(T));
+	}
+
 	/**
 	 * @brief Checks whether a given parameter @p id corresponds to a SECTION_TIMES parameter
 	 * @param [in] id Parameter id to be checked
@@ -178,6 +215,33 @@ namespace cadet
 		}
 	}
 
+	/**
+	 * @brief Provides access to the state of the simulation for event handlers
+	 */
+	class SimulatorEventState : public IEventState
+	{
+	public:
+		SimulatorEventState(const ISimulatableModel& model, double const* y, double const* yDot) : _model(model), _y(y), _yDot(yDot) { }
+
+		virtual unsigned int numDofs() const CADET_NOEXCEPT { return _model.numDofs(); }
+		virtual double const* solution() const CADET_NOEXCEPT { return _y; }
+		virtual double const* solutionTimeDerivative() const CADET_NOEXCEPT { return _yDot; }
+
+		virtual double outletConcentration(UnitOpIdx unitOp, unsigned int port, unsigned int comp) const
+		{
+			const int idx = _model.globalOutletIndex(unitOp, port, comp);
+			if (idx < 0)
+				throw InvalidParameterException("Outlet component " + std::to_string(comp) + " of port " + std::to_string(port) + " of unit operation " + std::to_string(unitOp) + " does not exist");
+
+			return _y[idx];
+		}
+
+	protected:
+		const ISimulatableModel& _model;
+		double const* const _y;
+		double const* const _yDot;
+	};
+
 	/**
 	 * @brief IDAS error handler function
 	 * @details Handles errors reported by the IDAS solver. See section 4.6.2 of the IDAS manual for details.
@@ -212,6 +276,7 @@ namespace cadet
 
 		LOG(Trace) << "==> Residual at t = " << t << " sec = " << secIdx;
 
+		ALLOCATION_SCOPE(sim->_allocResidual);
 		return sim->_model->residualWithJacobian(cadet::SimulationTime{t, secIdx}, cadet::ConstSimulationState{NVEC_DATA(y), NVEC_DATA(yDot)}, NVEC_DATA(res), 
 			cadet::AdJacobianParams{sim->_vecADres, sim->_vecADy, sim->numSensitivityAdDirections()});
 	}
@@ -308,6 +373,7 @@ namespace cadet
 
 		LOG(Trace) << "==> Solve at t = " << t << " alpha = " << alpha << " tol = " << tol;
 
+		ALLOCATION_SCOPE(sim->_allocLinearSolve);
 		return sim->_model->linearSolve(t, alpha, tol, NVEC_DATA(rhs), NVEC_DATA(weight), cadet::ConstSimulationState{NVEC_DATA(y), NVEC_DATA(yDot)});
 	}
 
@@ -319,13 +385,17 @@ namespace cadet
 			void *userData, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
 	{
 		cadet::Simulator* const sim = static_cast<cadet::Simulator*>(userData);
-		const std::vector<const double*> sensY = convertNVectorToStdVectorPtrs<const double*>(yS, ns);
-		const std::vector<const double*> sensYdot = convertNVectorToStdVectorPtrs<const double*>(ySDot, ns);
-		std::vector<double*> sensRes = convertNVectorToStdVectorPtrs<double*>(resS, ns);
 		const unsigned int secIdx = sim->getCurrentSection(t);
 		
 		LOG(Trace) << "==> Residual SENS at t = " << t << " sec = " << secIdx;
 
+		ALLOCATION_SCOPE(sim->_allocResidualSens);
+
+		// Reuse pointer vectors of the simulator (memory is reserved in preFwdSensInit())
+		fillNVectorPtrs(sim->_sensYPtrs, yS, ns);
+		fillNVectorPtrs(sim->_sensYdotPtrs, ySDot, ns);
+		fillNVectorPtrs(sim->_sensResPtrs, resS, ns);
+
 /*
 		reinterpret_cast<cadet::model::ModelSystem*>(sim->_model)->genJacobian(t, secIdx, NVEC_DATA(y), NVEC_DATA(yDot));
 		reinterpret_cast<cadet::model::ModelSystem*>(sim->_model)->genJacobian(ns, t, NVEC_DATA(y), NVEC_DATA(yDot), NVEC_DATA(res),
@@ -333,16 +403,40 @@ namespace cadet
 */
 
 		return sim->_model->residualSensFwd(ns, cadet::SimulationTime{t, secIdx}, cadet::ConstSimulationState{NVEC_DATA(y), NVEC_DATA(yDot)}, NVEC_DATA(res), 
-			sensY, sensYdot, sensRes, sim->_vecADres, NVEC_DATA(tmp1), NVEC_DATA(tmp2), NVEC_DATA(tmp3));
+			sim->_sensYPtrs, sim->_sensYdotPtrs, sim->_sensResPtrs, sim->_vecADres, NVEC_DATA(tmp1), NVEC_DATA(tmp2), NVEC_DATA(tmp3));
+	}
+
+	/**
+	* @brief IDAS wrapper function to call the event handler's evaluateEvents() method
+	*/
+	int rootFunctionWrapper(double t, N_Vector y, N_Vector yDot, double* gout, void* userData)
+	{
+		cadet::Simulator* const sim = static_cast<cadet::Simulator*>(userData);
+		const unsigned int secIdx = sim->getCurrentSection(t);
+		const SimulatorEventState state(*sim->_model, NVEC_DATA(y), NVEC_DATA(yDot));
+
+		// Exceptions must not propagate through the C code of IDAS, so they are
+		// stored and rethrown after IDASolve() has returned
+		try
+		{
+			sim->_eventHandler->evaluateEvents(t, secIdx, state, gout);
+		}
+		catch (...)
+		{
+			sim->_eventException = std::current_exception();
+			return -1;
+		}
+		return 0;
 	}
 
 	Simulator::Simulator() : _model(nullptr), _solRecorder(nullptr), _idaMemBlock(nullptr), _vecStateY(nullptr), 
 		_vecStateYdot(nullptr), _vecFwdYs(nullptr), _vecFwdYsDot(nullptr),
 		_relTolS(1.0e-9), _absTol(1, 1.0e-12), _relTol(1.0e-9), _initStepSize(1, 1.0e-6), _maxSteps(10000), _maxStepSize(0.0),
 		_nThreads(0), _sensErrorTestEnabled(true), _maxNewtonIter(3), _maxErrorTestFail(7), _maxConvTestFail(10),
-		_maxNewtonIterSens(3), _curSec(0), _skipConsistencyStateY(false), _skipConsistencySensitivity(false),
+		_maxNewtonIterSens(3), _sensSimultaneous(false), _curSec(0), _startSec(0), _checkpointFile(), _checkpointInterval(0.0), _cssMaxCycles(0), _cssTol(1e-8), _cssAndersonDepth(5), _denseOutput(false), _skipConsistencyStateY(false), _skipConsistencySensitivity(false),
 		_consistentInitMode(ConsistentInitialization::Full), _consistentInitModeSens(ConsistentInitialization::Full),
-		_vecADres(nullptr), _vecADy(nullptr), _lastIntTime(0.0), _notification(nullptr)
+		_vecADres(nullptr), _vecADy(nullptr), _lastIntTime(0.0), _recordStatistics(false), _statistics(), _timerStatistics(),
+		_prevIntegratorCounters(), _prevFactorizations(), _prevGmresIterations(), _prevCouplingGmresIterations(0), _notification(nullptr), _eventHandler(nullptr), _eventsFound(), _eventException(nullptr)
 	{
 #if defined(ACTIVE_SFAD) || defined(ACTIVE_SETFAD)
 		LOG(Debug) << "Resetting AD directions from " << ad::getDirections() << " to default " << ad::getMaxDirections();
@@ -522,6 +616,10 @@ namespace cadet
 			_vecFwdYs     = NVec_CloneArray(nSens, _vecStateY);
 			_vecFwdYsDot  = NVec_CloneArray(nSens, _vecStateYdot);
 
+			_sensYPtrs.reserve(nSens);
+			_sensYdotPtrs.reserve(nSens);
+			_sensResPtrs.reserve(nSens);
+
 			// Allocate memory for AD if not already done
 			if (!_vecADres)
 				_vecADres = new active[_model->numDofs()];
@@ -532,7 +630,7 @@ namespace cadet
 	{
 		// Initialize IDA sensitivity computation
 		// TODO: Use IDASensReInit if this is not the first time sensitivities are activated
-		IDASensInit(_idaMemBlock, nSens, IDA_STAGGERED, &cadet::residualSensWrapper, _vecFwdYs, _vecFwdYsDot);
+		IDASensInit(_idaMemBlock, nSens, _sensSimultaneous ? IDA_SIMULTANEOUS : IDA_STAGGERED, &cadet::residualSensWrapper, _vecFwdYs, _vecFwdYsDot);
 
 		// Set sensitivity integration tolerances
 		IDASensSStolerances(_idaMemBlock, _relTolS, _absTolS.data());
@@ -1019,19 +1117,26 @@ namespace cadet
 
 		_timerIntegration.start();
 
+#ifdef CADET_ALLOCATION_TRACKING
+		_allocResidual.reset();
+		_allocResidualSens.reset();
+		_allocLinearSolve.reset();
+#endif
+
 		// Setup AD vectors by model
 		_model->prepareADvectors(AdJacobianParams{_vecADres, _vecADy, numSensitivityAdDirections()});
 
-		std::vector<double>::const_iterator it;
-		double tOut = 0.0;
+		// Enable rootfinding if event functions are present
+		const unsigned int nEvents = _eventHandler ? _eventHandler->numEvents() : 0;
+		_eventsFound.resize(nEvents);
+		IDARootInit(_idaMemBlock, nEvents, (nEvents > 0) ? &rootFunctionWrapper : nullptr);
 
-		const bool writeAtUserTimes = _solutionTimes.size() > 0;
 		const bool wantSensitivities = _sensitiveParams.slices() > 0;
 
 		LOG(Debug) << "#MaxNewton: " << _maxNewtonIter << ", #MaxErrTestFail: " << _maxErrorTestFail << ", #MaxConvTestFail: " << _maxConvTestFail;
 		if (wantSensitivities)
 		{
-			LOG(Debug) << "Sensitvities in error test: " << _sensErrorTestEnabled << ", #MaxNewtonSens: " << _maxNewtonIterSens;
+			LOG(Debug) << "Sensitvities in error test: " << _sensErrorTestEnabled << ", #MaxNewtonSens: " << _maxNewtonIterSens << ", simultaneous corrector: " << _sensSimultaneous;
 		}
 
 		if (_solRecorder)
@@ -1040,23 +1145,76 @@ namespace cadet
 			_model->reportSolutionStructure(*_solRecorder);
 		}
 
+		LOG(Debug) << "Integration span: [" << static_cast<double>(_sectionTimes[0]) << ", " << static_cast<double>(_sectionTimes.back()) << "] sections";
+		
+		if (_solutionTimes.size() > 0)
+		{
+			LOG(Debug) << "Solution time span: [" << _solutionTimes[0] << ", " << _solutionTimes.back() << "]";
+		}
+
+		// Start at the first section or at the section loaded from a checkpoint
+		const unsigned int startSec = _startSec;
+		_startSec = 0;
+		if (startSec >= _sectionTimes.size() - 1)
+			throw InvalidParameterException("Start section " + std::to_string(startSec) + " exceeds number of sections " + std::to_string(_sectionTimes.size() - 1));
+
+		// Converge to cyclic steady state before recording the final cycle
+		if ((_cssMaxCycles > 0) && (startSec == 0))
+		{
+			if (!solveCyclicSteadyState())
+			{
+				_lastIntTime = _timerIntegration.stop();
+				return;
+			}
+		}
+
+		if (_recordStatistics)
+			beginSolverStatistics();
+
+		if (!integrateSections(startSec, true))
+		{
+			_lastIntTime = _timerIntegration.stop();
+			return;
+		}
+
+		_lastIntTime = _timerIntegration.stop();
+
+#ifdef CADET_ALLOCATION_TRACKING
+		LOG(Info) << "Heap allocations in residual: " << _allocResidual.allocations << " in " << _allocResidual.calls << " calls (max " << _allocResidual.maxAllocations << " per call)";
+		LOG(Info) << "Heap allocations in sensitivity residual: " << _allocResidualSens.allocations << " in " << _allocResidualSens.calls << " calls (max " << _allocResidualSens.maxAllocations << " per call)";
+		LOG(Info) << "Heap allocations in linear solve: " << _allocLinearSolve.allocations << " in " << _allocLinearSolve.calls << " calls (max " << _allocLinearSolve.maxAllocations << " per call)";
+#endif
+
+		if (_notification)
+			_notification->timeIntegrationEnd();
+	}
+
+	bool Simulator::integrateSections(unsigned int startSec, bool record)
+	{
+		std::vector<double>::const_iterator it;
+		double tOut = 0.0;
+
+		const bool writeAtUserTimes = record && (_solutionTimes.size() > 0);
+		// Solver statistics are recorded after each internal integrator step, which
+		// requires interpolating the user specified solution times
+		const bool denseOutput = writeAtUserTimes && (_denseOutput || _recordStatistics);
+		const bool wantSensitivities = _sensitiveParams.slices() > 0;
+
 		// Decide whether to use user specified solution output times (IDA_NORMAL)
-		// or internal integrator steps (IDA_ONE_STEP)
+		// or internal integrator steps (IDA_ONE_STEP). If nothing is recorded,
+		// directly integrate to the end of each section (IDA_NORMAL). With dense
+		// output, user specified solution times are interpolated after each
+		// internal integrator step (IDA_ONE_STEP).
 		int idaTask = IDA_ONE_STEP;
-		if (writeAtUserTimes)
+		if ((writeAtUserTimes && !denseOutput) || !record)
 		{
 			idaTask = IDA_NORMAL;
 		}
 
-		LOG(Debug) << "Integration span: [" << static_cast<double>(_sectionTimes[0]) << ", " << static_cast<double>(_sectionTimes.back()) << "] sections";
-		
-		if (writeAtUserTimes)
-		{
-			LOG(Debug) << "Solution time span: [" << _solutionTimes[0] << ", " << _solutionTimes.back() << "]";
-		}
+		_lastCheckpoint = std::chrono::steady_clock::now();
 
-		double curT = static_cast<double>(_sectionTimes[0]);
-		_curSec = 0;
+		double curT = static_cast<double>(_sectionTimes[startSec]);
+		_curSec = startSec;
 		const double tEnd = writeAtUserTimes ? _solutionTimes.back() : static_cast<double>(_sectionTimes.back());
 		while (curT < tEnd)
 		{
@@ -1083,6 +1241,10 @@ namespace cadet
 
 			LOG(Debug) << " ###### SECTION " << _curSec << " from " << startTime << " to " << endTime;
 
+			// The time integrator is restarted at this point, which makes it a natural checkpoint
+			if (record && !_checkpointFile.empty() && (_curSec > startSec))
+				writeCheckpoint(startTime);
+
 			// IDAS Step 7.3: Set the initial step size
 			const double stepSize = _initStepSize.size() > 1 ? _initStepSize[_curSec] : _initStepSize[0];
 			IDASetInitStep(_idaMemBlock, stepSize);
@@ -1094,111 +1256,23 @@ namespace cadet
 			_model->notifyDiscontinuousSectionTransition(curT, _curSec, AdJacobianParams{_vecADres, _vecADy, numSensitivityAdDirections()});
 
 			// Compute consistent initial values
-			LOG(Debug) << "---====--- CONSISTENCY ---====--- ";
-			const double consPrev = _model->residualNorm(SimulationTime{curT, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)});
-			LOG(Debug) << " ==========> Consistency error prev: " << consPrev;
-
-			if (!_skipConsistencyStateY && (_consistentInitMode != ConsistentInitialization::None))
-			{
-				const ConsistentInitialization mode = currentConsistentInitMode(_consistentInitMode, _curSec);
-				if (mode == ConsistentInitialization::Full)
-				{
-					_model->consistentInitialConditions(SimulationTime{curT, _curSec}, SimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}, 
-						AdJacobianParams{_vecADres, _vecADy, numSensitivityAdDirections()}, _algTol);
-
-					const double consPost = _model->residualNorm(SimulationTime{curT, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)});
-					LOG(Debug) << " ==========> Consistency error post Full: " << consPost;
-				}
-				else if (mode == ConsistentInitialization::Lean)
-				{
-					_model->leanConsistentInitialConditions(SimulationTime{curT, _curSec}, SimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)},
-						AdJacobianParams{_vecADres, _vecADy, numSensitivityAdDirections()}, _algTol);
-
-					const double consPost = _model->residualNorm(SimulationTime{curT, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)});
-					LOG(Debug) << " ==========> Consistency error post Lean: " << consPost;
-				}
-				else
-				{
-					LOG(Debug) << " ==========> Consistent initialization NOT performed (mode " << to_string(_consistentInitMode) << ")";
-				}
-
-				LOG(Debug) << "y = " << log::VectorPtr<double>(NVEC_DATA(_vecStateY), _model->numDofs()) << ";";
-				LOG(Debug) << "yDot = " << log::VectorPtr<double>(NVEC_DATA(_vecStateYdot), _model->numDofs()) << ";";
-				LOG(Debug) << "Contains NaN: y = " << hasNaN(_vecStateY) << " yDot = " << hasNaN(_vecStateYdot);
-			}
-			_skipConsistencyStateY = false;
-
-			if (wantSensitivities && !_skipConsistencySensitivity && (_consistentInitModeSens != ConsistentInitialization::None))
-			{
-#ifdef CADET_DEBUG
-				const std::vector<const double*> sensYdbg = convertNVectorToStdVectorPtrs<const double*>(_vecFwdYs, _sensitiveParams.slices());
-				const std::vector<const double*> sensYdotDbg = convertNVectorToStdVectorPtrs<const double*>(_vecFwdYsDot, _sensitiveParams.slices());
-
-				std::vector<double> norms(_sensitiveParams.slices(), 0.0);
-				std::vector<double> temp(_model->numDofs(), 0.0);
-				_model->residualSensFwdNorm(_sensitiveParams.slices(), SimulationTime{curT, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)},
-					sensYdbg, sensYdotDbg, norms.data(), _vecADres, temp.data());
-
-				LOG(Debug) << " ==========> Sens consistency error prev: " << norms;
-#endif
-
-				const ConsistentInitialization mode = currentConsistentInitMode(_consistentInitModeSens, _curSec);
-				if (mode == ConsistentInitialization::Full)
-				{
-					// Compute consistent initial conditions for sensitivity subsystems
-					std::vector<double*> sensY = convertNVectorToStdVectorPtrs<double*>(_vecFwdYs, _sensitiveParams.slices());
-					std::vector<double*> sensYdot = convertNVectorToStdVectorPtrs<double*>(_vecFwdYsDot, _sensitiveParams.slices());
-					_model->consistentInitialSensitivity(SimulationTime{curT, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}, sensY, sensYdot, _vecADres, _vecADy);
-
-#ifdef CADET_DEBUG
-					_model->residualSensFwdNorm(_sensitiveParams.slices(), SimulationTime{curT, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)},
-						sensYdbg, sensYdotDbg, norms.data(), _vecADres, temp.data());
-
-					LOG(Debug) << " ==========> Sens consistency error post Full: " << norms;
-#endif
-				}
-				else if (mode == ConsistentInitialization::Lean)
-				{
-					// Compute consistent initial conditions for sensitivity subsystems
-					std::vector<double*> sensY = convertNVectorToStdVectorPtrs<double*>(_vecFwdYs, _sensitiveParams.slices());
-					std::vector<double*> sensYdot = convertNVectorToStdVectorPtrs<double*>(_vecFwdYsDot, _sensitiveParams.slices());
-					_model->leanConsistentInitialSensitivity(SimulationTime{curT, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}, sensY, sensYdot, _vecADres, _vecADy);
-
-#ifdef CADET_DEBUG
-					_model->residualSensFwdNorm(_sensitiveParams.slices(), SimulationTime{curT, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)},
-						sensYdbg, sensYdotDbg, norms.data(), _vecADres, temp.data());
-
-					LOG(Debug) << " ==========> Sens consistency error post Lean: " << norms;
-#endif
-				}
-				else
-				{
-					LOG(Debug) << " ==========> Sens consistent initialization NOT performed (mode " << to_string(_consistentInitModeSens) << ")";
-				}
-
-#ifdef CADET_DEBUG
-				for (unsigned int j = 0; j < norms.size(); ++j)
-				{
-					LOG(Debug) << "sensY[" << j << "] = " << log::VectorPtr<double>(NVEC_DATA(_vecFwdYs[j]), _model->numDofs()) << ";";
-					LOG(Debug) << "sensYdot[" << j << "] = " << log::VectorPtr<double>(NVEC_DATA(_vecFwdYsDot[j]), _model->numDofs()) << ";";
-					LOG(Debug) << "Contains NaN: sensY[" << j << "] = " << hasNaN(_vecFwdYs[j]) << " sensYdot[" << j << "] = " << hasNaN(_vecFwdYsDot[j]);
-				}
-#endif
-			}
-			_skipConsistencySensitivity = false;
+			computeConsistentInitialValues(curT);
 
 			// Notify user and check for user abort
 			if (_notification)
 			{
 				const double progress = (curT - static_cast<double>(_sectionTimes[0])) / (tEnd - static_cast<double>(_sectionTimes[0]));
 				if (!_notification->timeIntegrationSection(_curSec, curT, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), progress))
-					return;
+					return false;
 			}
 
 			// IDAS Step 5.2: Re-initialization of the solver
 			IDAReInit(_idaMemBlock, startTime, _vecStateY, _vecStateYdot);
 			if (wantSensitivities)
-				IDASensReInit(_idaMemBlock, IDA_STAGGERED, _vecFwdYs, _vecFwdYsDot);
+				IDASensReInit(_idaMemBlock, _sensSimultaneous ? IDA_SIMULTANEOUS : IDA_STAGGERED, _vecFwdYs, _vecFwdYsDot);
+
+			// Re-initialization resets the counters of the time integrator
+			_prevIntegratorCounters = IntegratorCounters{0, 0, 0, 0, 0, 0, 0, 0, 0};
 
 			// Inititalize the IDA solver flag
 			int solverFlag = IDA_SUCCESS;
@@ -1212,11 +1286,15 @@ namespace cadet
 				// Initialize iterator and forward it to the first solution time that lies inside the current section
 				it = _solutionTimes.begin();
 				while ((*it) <= startTime) ++it;
+
+				// Dense output does not stop at user specified times
+				if (denseOutput)
+					tOut = endTime;
 			}
 			else
 			{
 				// Always write initial conditions if solutions are written at integration times
-				if (_curSec == 0) writeSolution(curT);
+				if (record && (_curSec == 0)) writeSolution(curT);
 
 				// Here tOut - only during the first call to IDASolve - specifies the direction
 				// and rough scale of the independent variable, see IDAS Guide p.33
@@ -1234,12 +1312,18 @@ namespace cadet
 					// otherwise integrate till IDA_TSTOP_RETURN
 					if (it == _solutionTimes.end())
 						break;
-					else
+					else if (!denseOutput)
 						tOut = *it;
 				}
 
 				// IDA Step 11: Advance solution in time
 				solverFlag = IDASolve(_idaMemBlock, tOut, &curT, _vecStateY, _vecStateYdot, idaTask);
+				if (_eventException)
+				{
+					std::exception_ptr e = nullptr;
+					std::swap(e, _eventException);
+					std::rethrow_exception(e);
+				}
 				LOG(Debug) << "Solve from " << curT << " to " << tOut << " => " 
 					<< (solverFlag == IDA_SUCCESS ? "IDA_SUCCESS" : "") << (solverFlag == IDA_TSTOP_RETURN ? "IDA_TSTOP_RETURN" : "");
 
@@ -1289,6 +1373,9 @@ namespace cadet
 					}
 				}
 	#endif
+				if (record && _recordStatistics && (solverFlag >= 0))
+					recordSolverStatistics(curT, wantSensitivities);
+
 				switch (solverFlag)
 				{
 				case IDA_SUCCESS:
@@ -1301,23 +1388,61 @@ namespace cadet
 						IDAGetSens(_idaMemBlock, &curT, _vecFwdYs);
 						IDAGetSensDky(_idaMemBlock, curT, 1, _vecFwdYsDot);
 					}
-					writeSolution(curT);
-					++it;
+					if (denseOutput)
+						writeDenseOutput(curT, it);
+					else
+					{
+						if (record)
+							writeSolution(curT);
+						++it;
+					}
 
 					// Notify user and check for user abort
 					if (_notification)
 					{
 						const double progress = (curT - static_cast<double>(_sectionTimes[0])) / (tEnd - static_cast<double>(_sectionTimes[0]));
 						if (!_notification->timeIntegrationStep(_curSec, curT, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), progress))
-						{
-							_lastIntTime = _timerIntegration.stop();
-							return;
-						}
+							return false;
 					}
 					break;
 				case IDA_ROOT_RETURN:
-					// A root was found
-					// Eventually call some routine
+					// An event function has a root at curT
+
+					// Extract sensitivity information from IDA (required for consistent initialization
+					// and output of sensitivities)
+					if (wantSensitivities)
+					{
+						IDAGetSens(_idaMemBlock, &curT, _vecFwdYs);
+						IDAGetSensDky(_idaMemBlock, curT, 1, _vecFwdYsDot);
+					}
+
+					if (record && !writeAtUserTimes)
+						writeSolution(curT);
+					else if (denseOutput)
+						writeDenseOutput(curT, it);
+
+					if (handleEvents(curT))
+					{
+						// The event handler has modified the model, so restart the time integrator at the event time
+						_model->notifyDiscontinuousSectionTransition(curT, _curSec, AdJacobianParams{_vecADres, _vecADy, numSensitivityAdDirections()});
+						computeConsistentInitialValues(curT);
+
+						IDAReInit(_idaMemBlock, curT, _vecStateY, _vecStateYdot);
+						if (wantSensitivities)
+							IDASensReInit(_idaMemBlock, _sensSimultaneous ? IDA_SIMULTANEOUS : IDA_STAGGERED, _vecFwdYs, _vecFwdYsDot);
+
+						_prevIntegratorCounters = IntegratorCounters{0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+						IDASetStopTime(_idaMemBlock, endTime);
+					}
+					else if (denseOutput)
+					{
+						// The integrator has already stepped beyond the event, write
+						// remaining solution times of this step before it proceeds
+						double tStep = curT;
+						IDAGetCurrentTime(_idaMemBlock, &tStep);
+						writeDenseOutput(tStep, it);
+					}
 					break;
 				case IDA_TSTOP_RETURN:
 					// Extract sensitivity information from IDA (required for consistent initialization
@@ -1328,8 +1453,11 @@ namespace cadet
 						IDAGetSensDky(_idaMemBlock, curT, 1, _vecFwdYsDot);
 					}
 
+					if (denseOutput)
+						writeDenseOutput(curT, it);
+
 					// Section end time was reached (in previous step)
-					if (!writeAtUserTimes && (endTime == static_cast<double>(_sectionTimes.back())))
+					if (record && !writeAtUserTimes && (endTime == static_cast<double>(_sectionTimes.back())))
 					{
 						// Write a solution for the ultimate endTime in the last section,
 						// when we write at integration times.
@@ -1341,10 +1469,7 @@ namespace cadet
 					{
 						const double progress = (curT - static_cast<double>(_sectionTimes[0])) / (tEnd - static_cast<double>(_sectionTimes[0]));
 						if (!_notification->timeIntegrationStep(_curSec, curT, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot), progress))
-						{
-							_lastIntTime = _timerIntegration.stop();
-							return;
-						}
+							return false;
 					}
 					break;
 				default:
@@ -1368,10 +1493,195 @@ namespace cadet
 
 		} // for (_sec ...)
 
-		_lastIntTime = _timerIntegration.stop();
+		return true;
+	}
 
-		if (_notification)
-			_notification->timeIntegrationEnd();
+	void Simulator::computeConsistentInitialValues(double t)
+	{
+		const bool wantSensitivities = _sensitiveParams.slices() > 0;
+
+		LOG(Debug) << "---====--- CONSISTENCY ---====--- ";
+		const double consPrev = _model->residualNorm(SimulationTime{t, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)});
+		LOG(Debug) << " ==========> Consistency error prev: " << consPrev;
+
+		if (!_skipConsistencyStateY && (_consistentInitMode != ConsistentInitialization::None))
+		{
+			const ConsistentInitialization mode = currentConsistentInitMode(_consistentInitMode, _curSec);
+			if (mode == ConsistentInitialization::Full)
+			{
+				_model->consistentInitialConditions(SimulationTime{t, _curSec}, SimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}, 
+					AdJacobianParams{_vecADres, _vecADy, numSensitivityAdDirections()}, _algTol);
+
+				const double consPost = _model->residualNorm(SimulationTime{t, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)});
+				LOG(Debug) << " ==========> Consistency error post Full: " << consPost;
+			}
+			else if (mode == ConsistentInitialization::Lean)
+			{
+				_model->leanConsistentInitialConditions(SimulationTime{t, _curSec}, SimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)},
+					AdJacobianParams{_vecADres, _vecADy, numSensitivityAdDirections()}, _algTol);
+
+				const double consPost = _model->residualNorm(SimulationTime{t, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)});
+				LOG(Debug) << " ==========> Consistency error post Lean: " << consPost;
+			}
+			else
+			{
+				LOG(Debug) << " ==========> Consistent initialization NOT performed (mode " << to_string(_consistentInitMode) << ")";
+			}
+
+			LOG(Debug) << "y = " << log::VectorPtr<double>(NVEC_DATA(_vecStateY), _model->numDofs()) << ";";
+			LOG(Debug) << "yDot = " << log::VectorPtr<double>(NVEC_DATA(_vecStateYdot), _model->numDofs()) << ";";
+			LOG(Debug) << "Contains NaN: y = " << hasNaN(_vecStateY) << " yDot = " << hasNaN(_vecStateYdot);
+		}
+		_skipConsistencyStateY = false;
+
+		if (wantSensitivities && !_skipConsistencySensitivity && (_consistentInitModeSens != ConsistentInitialization::None))
+		{
+#ifdef CADET_DEBUG
+			const std::vector<const double*> sensYdbg = convertNVectorToStdVectorPtrs<const double*>(_vecFwdYs, _sensitiveParams.slices());
+			const std::vector<const double*> sensYdotDbg = convertNVectorToStdVectorPtrs<const double*>(_vecFwdYsDot, _sensitiveParams.slices());
+
+			std::vector<double> norms(_sensitiveParams.slices(), 0.0);
+			std::vector<double> temp(_model->numDofs(), 0.0);
+			_model->residualSensFwdNorm(_sensitiveParams.slices(), SimulationTime{t, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)},
+				sensYdbg, sensYdotDbg, norms.data(), _vecADres, temp.data());
+
+			LOG(Debug) << " ==========> Sens consistency error prev: " << norms;
+#endif
+
+			const ConsistentInitialization mode = currentConsistentInitMode(_consistentInitModeSens, _curSec);
+			if (mode == ConsistentInitialization::Full)
+			{
+				// Compute consistent initial conditions for sensitivity subsystems
+				std::vector<double*> sensY = convertNVectorToStdVectorPtrs<double*>(_vecFwdYs, _sensitiveParams.slices());
+				std::vector<double*> sensYdot = convertNVectorToStdVectorPtrs<double*>(_vecFwdYsDot, _sensitiveParams.slices());
+				_model->consistentInitialSensitivity(SimulationTime{t, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}, sensY, sensYdot, _vecADres, _vecADy);
+
+#ifdef CADET_DEBUG
+				_model->residualSensFwdNorm(_sensitiveParams.slices(), SimulationTime{t, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)},
+					sensYdbg, sensYdotDbg, norms.data(), _vecADres, temp.data());
+
+				LOG(Debug) << " ==========> Sens consistency error post Full: " << norms;
+#endif
+			}
+			else if (mode == ConsistentInitialization::Lean)
+			{
+				// Compute consistent initial conditions for sensitivity subsystems
+				std::vector<double*> sensY = convertNVectorToStdVectorPtrs<double*>(_vecFwdYs, _sensitiveParams.slices());
+				std::vector<double*> sensYdot = convertNVectorToStdVectorPtrs<double*>(_vecFwdYsDot, _sensitiveParams.slices());
+				_model->leanConsistentInitialSensitivity(SimulationTime{t, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}, sensY, sensYdot, _vecADres, _vecADy);
+
+#ifdef CADET_DEBUG
+				_model->residualSensFwdNorm(_sensitiveParams.slices(), SimulationTime{t, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)},
+					sensYdbg, sensYdotDbg, norms.data(), _vecADres, temp.data());
+
+				LOG(Debug) << " ==========> Sens consistency error post Lean: " << norms;
+#endif
+			}
+			else
+			{
+				LOG(Debug) << " ==========> Sens consistent initialization NOT performed (mode " << to_string(_consistentInitModeSens) << ")";
+			}
+
+#ifdef CADET_DEBUG
+			for (unsigned int j = 0; j < norms.size(); ++j)
+			{
+				LOG(Debug) << "sensY[" << j << "] = " << log::VectorPtr<double>(NVEC_DATA(_vecFwdYs[j]), _model->numDofs()) << ";";
+				LOG(Debug) << "sensYdot[" << j << "] = " << log::VectorPtr<double>(NVEC_DATA(_vecFwdYsDot[j]), _model->numDofs()) << ";";
+				LOG(Debug) << "Contains NaN: sensY[" << j << "] = " << hasNaN(_vecFwdYs[j]) << " sensYdot[" << j << "] = " << hasNaN(_vecFwdYsDot[j]);
+			}
+#endif
+		}
+		_skipConsistencySensitivity = false;
+	}
+
+	bool Simulator::solveCyclicSteadyState()
+	{
+		const unsigned int nDof = NVEC_LENGTH(_vecStateY);
+		const unsigned int nSens = _sensitiveParams.slices();
+
+		// The fixed-point iteration acts on the initial state and the initial forward sensitivities,
+		// which are stored consecutively in x
+		std::vector<double> x(nDof * (1 + nSens));
+		std::vector<double> fx(nDof * (1 + nSens));
+		nonlin::AndersonAcceleration accel(x.size(), _cssAndersonDepth);
+
+		gatherCycleState(x.data());
+		for (unsigned int cycle = 1; cycle <= _cssMaxCycles; ++cycle)
+		{
+			if (!integrateSections(0, false))
+				return false;
+
+			// Compare state at the end of the cycle with the state at its beginning
+			gatherCycleState(fx.data());
+
+			double residual = 0.0;
+			for (unsigned int b = 0; b < 1 + nSens; ++b)
+			{
+				double diffNorm = 0.0;
+				double stateNorm = 0.0;
+				for (unsigned int i = b * nDof; i < (b + 1) * nDof; ++i)
+				{
+					diffNorm = std::max(diffNorm, std::abs(fx[i] - x[i]));
+					stateNorm = std::max(stateNorm, std::abs(fx[i]));
+				}
+				residual = std::max(residual, diffNorm / std::max(1.0, stateNorm));
+			}
+
+			LOG(Debug) << "CSS cycle " << cycle << ": residual " << residual;
+
+			// State at end of cycle is kept as initial state of the next cycle if converged
+			if (residual <= _cssTol)
+			{
+				LOG(Info) << "Cyclic steady state reached after " << cycle << " cycles (residual " << residual << ")";
+				return true;
+			}
+
+			if (cycle == _cssMaxCycles)
+				break;
+
+			accel.update(x.data(), fx.data());
+			scatterCycleState(x.data());
+		}
+
+		LOG(Warning) << "Cyclic steady state not reached within " << _cssMaxCycles << " cycles";
+		return true;
+	}
+
+	void Simulator::gatherCycleState(double* const x) const
+	{
+		const unsigned int nDof = NVEC_LENGTH(_vecStateY);
+		std::copy_n(NVEC_DATA(_vecStateY), nDof, x);
+		for (unsigned int i = 0; i < _sensitiveParams.slices(); ++i)
+			std::copy_n(NVEC_DATA(_vecFwdYs[i]), nDof, x + (i + 1) * nDof);
+	}
+
+	void Simulator::scatterCycleState(double const* const x)
+	{
+		const unsigned int nDof = NVEC_LENGTH(_vecStateY);
+		const unsigned int nSens = _sensitiveParams.slices();
+		std::copy_n(x, nDof, NVEC_DATA(_vecStateY));
+		for (unsigned int i = 0; i < nSens; ++i)
+			std::copy_n(x + (i + 1) * nDof, nDof, NVEC_DATA(_vecFwdYs[i]));
+
+		// The time derivatives still belong to the end of the previous cycle and the extrapolated
+		// algebraic variables are not consistent. Hence, a full consistent initialization is
+		// performed regardless of the configured mode.
+		const double t = static_cast<double>(_sectionTimes[0]);
+		_curSec = 0;
+		_model->notifyDiscontinuousSectionTransition(t, _curSec, AdJacobianParams{_vecADres, _vecADy, numSensitivityAdDirections()});
+		_model->consistentInitialConditions(SimulationTime{t, _curSec}, SimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)},
+			AdJacobianParams{_vecADres, _vecADy, numSensitivityAdDirections()}, _algTol);
+
+		if (nSens > 0)
+		{
+			std::vector<double*> sensY = convertNVectorToStdVectorPtrs<double*>(_vecFwdYs, nSens);
+			std::vector<double*> sensYdot = convertNVectorToStdVectorPtrs<double*>(_vecFwdYsDot, nSens);
+			_model->consistentInitialSensitivity(SimulationTime{t, _curSec}, ConstSimulationState{NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot)}, sensY, sensYdot, _vecADres, _vecADy);
+		}
+
+		// Do not repeat the consistent initialization at the beginning of the next cycle
+		_skipConsistencyStateY = true;
+		_skipConsistencySensitivity = true;
 	}
 
 	double const* Simulator::getLastSolution(unsigned int& len) const
@@ -1463,6 +1773,17 @@ namespace cadet
 		if (paramProvider.exists("MAX_NEWTON_ITER_SENS"))
 			_maxNewtonIterSens = paramProvider.getInt("MAX_NEWTON_ITER_SENS");
 
+		if (paramProvider.exists("SENS_CORRECTOR"))
+		{
+			const std::string corrector = paramProvider.getString("SENS_CORRECTOR");
+			if (corrector == "SIMULTANEOUS")
+				_sensSimultaneous = true;
+			else if (corrector == "STAGGERED")
+				_sensSimultaneous = false;
+			else
+				throw InvalidParameterException("Unknown sensitivity corrector method " + corrector + " in field SENS_CORRECTOR");
+		}
+
 		paramProvider.popScope();
 
 		if (paramProvider.exists("NTHREADS"))
@@ -1474,12 +1795,34 @@ namespace cadet
 		if (paramProvider.exists("USER_SOLUTION_TIMES"))
 			_solutionTimes = paramProvider.getDoubleArray("USER_SOLUTION_TIMES");
 
+		if (paramProvider.exists("DENSE_OUTPUT"))
+			_denseOutput = paramProvider.getBool("DENSE_OUTPUT");
+
 		if (paramProvider.exists("CONSISTENT_INIT_MODE"))
 			_consistentInitMode = toConsistentInitialization(paramProvider.getInt("CONSISTENT_INIT_MODE"));
 
 		if (paramProvider.exists("CONSISTENT_INIT_MODE_SENS"))
 			_consistentInitModeSens = toConsistentInitialization(paramProvider.getInt("CONSISTENT_INIT_MODE_SENS"));
 
+		if (paramProvider.exists("CSS_MAX_CYCLES"))
+		{
+			const int maxCycles = paramProvider.getInt("CSS_MAX_CYCLES");
+			if (maxCycles < 0)
+				throw InvalidParameterException("CSS_MAX_CYCLES has to be non-negative");
+			_cssMaxCycles = maxCycles;
+		}
+
+		if (paramProvider.exists("CSS_TOL"))
+			_cssTol = paramProvider.getDouble("CSS_TOL");
+
+		if (paramProvider.exists("CSS_ANDERSON_DEPTH"))
+		{
+			const int depth = paramProvider.getInt("CSS_ANDERSON_DEPTH");
+			if (depth < 0)
+				throw InvalidParameterException("CSS_ANDERSON_DEPTH has to be non-negative");
+			_cssAndersonDepth = depth;
+		}
+
 		// @todo: Read more configuration values
 	}
 
@@ -1592,6 +1935,12 @@ namespace cadet
 			IDASetSensMaxNonlinIters(_idaMemBlock, nIter);
 	}
 
+	void Simulator::setSimultaneousSensitivityCorrector(bool simultaneous)
+	{
+		// Takes effect on the next (re-)initialization of the sensitivity system
+		_sensSimultaneous = simultaneous;
+	}
+
 
 
 	bool Simulator::reconfigureModel(IParameterProvider& paramProvider)
@@ -1651,6 +2000,250 @@ namespace cadet
 		_solRecorder->endTimestep();
 	}
 
+	void Simulator::beginSolverStatistics()
+	{
+		_statistics.clear();
+
+		const unsigned int nUnits = _model->numModels();
+		_statistics.numUnits = nUnits;
+		_statistics.unitOpIds.resize(nUnits);
+		_prevFactorizations.resize(nUnits);
+		_prevGmresIterations.resize(nUnits);
+		for (unsigned int i = 0; i < nUnits; ++i)
+		{
+			const LinearSolverStatistics stats = _model->linearSolverStatistics(i);
+			_statistics.unitOpIds[i] = _model->getModel(i)->unitOperationId();
+			_prevFactorizations[i] = stats.numFactorizations;
+			_prevGmresIterations[i] = stats.numGmresIterations;
+		}
+		_prevCouplingGmresIterations = _model->numCouplingGmresIterations();
+
+		_prevIntegratorCounters = IntegratorCounters{0, 0, 0, 0, 0, 0, 0, 0, 0};
+		_timerStatistics.start();
+	}
+
+	void Simulator::recordSolverStatistics(double t, bool wantSensitivities)
+	{
+		_statistics.time.push_back(t);
+		_statistics.wallTime.push_back(_timerStatistics.stop());
+
+		double stepSize = 0.0;
+		IDAGetLastStep(_idaMemBlock, &stepSize);
+		_statistics.lastStepSize.push_back(stepSize);
+
+		IDAGetCurrentStep(_idaMemBlock, &stepSize);
+		_statistics.nextStepSize.push_back(stepSize);
+
+		IntegratorCounters cur{0, 0, 0, 0, 0, 0, 0, 0, 0};
+		IDAGetNumSteps(_idaMemBlock, &cur.numSteps);
+		IDAGetNumResEvals(_idaMemBlock, &cur.numResEvals);
+		IDAGetNumNonlinSolvIters(_idaMemBlock, &cur.numNewtonIters);
+		IDAGetNumNonlinSolvConvFails(_idaMemBlock, &cur.numConvFails);
+		IDAGetNumErrTestFails(_idaMemBlock, &cur.numErrTestFails);
+
+		_statistics.numSteps.push_back(cur.numSteps - _prevIntegratorCounters.numSteps);
+		_statistics.numResEvals.push_back(cur.numResEvals - _prevIntegratorCounters.numResEvals);
+		_statistics.numNewtonIters.push_back(cur.numNewtonIters - _prevIntegratorCounters.numNewtonIters);
+		_statistics.numConvFails.push_back(cur.numConvFails - _prevIntegratorCounters.numConvFails);
+		_statistics.numErrTestFails.push_back(cur.numErrTestFails - _prevIntegratorCounters.numErrTestFails);
+
+		if (wantSensitivities)
+		{
+			IDAGetSensNumResEvals(_idaMemBlock, &cur.numSensResEvals);
+			IDAGetSensNumNonlinSolvIters(_idaMemBlock, &cur.numSensNewtonIters);
+			IDAGetSensNumNonlinSolvConvFails(_idaMemBlock, &cur.numSensConvFails);
+			IDAGetSensNumErrTestFails(_idaMemBlock, &cur.numSensErrTestFails);
+
+			_statistics.numSensResEvals.push_back(cur.numSensResEvals - _prevIntegratorCounters.numSensResEvals);
+			_statistics.numSensNewtonIters.push_back(cur.numSensNewtonIters - _prevIntegratorCounters.numSensNewtonIters);
+			_statistics.numSensConvFails.push_back(cur.numSensConvFails - _prevIntegratorCounters.numSensConvFails);
+			_statistics.numSensErrTestFails.push_back(cur.numSensErrTestFails - _prevIntegratorCounters.numSensErrTestFails);
+		}
+
+		_prevIntegratorCounters = cur;
+
+		for (unsigned int i = 0; i < _statistics.numUnits; ++i)
+		{
+			const LinearSolverStatistics stats = _model->linearSolverStatistics(i);
+			_statistics.numFactorizations.push_back(stats.numFactorizations - _prevFactorizations[i]);
+			_statistics.numGmresIterations.push_back(stats.numGmresIterations - _prevGmresIterations[i]);
+			_prevFactorizations[i] = stats.numFactorizations;
+			_prevGmresIterations[i] = stats.numGmresIterations;
+		}
+
+		const int couplingGmres = _model->numCouplingGmresIterations();
+		_statistics.numCouplingGmresIterations.push_back(couplingGmres - _prevCouplingGmresIterations);
+		_prevCouplingGmresIterations = couplingGmres;
+
+		_timerStatistics.start();
+	}
+
+	void Simulator::setCheckpointFile(const char* fileName)
+	{
+		_checkpointFile = fileName ? fileName : "";
+	}
+
+	void Simulator::setCheckpointInterval(double interval)
+	{
+		if (interval < 0.0)
+			throw InvalidParameterException("Checkpoint interval has to be non-negative");
+
+		_checkpointInterval = interval;
+	}
+
+	void Simulator::writeDenseOutput(double t, std::vector<double>::const_iterator& it)
+	{
+		if ((it == _solutionTimes.end()) || (*it > t))
+			return;
+
+		// All pending solution times up to t are covered by the interpolating polynomial of the last step
+		const bool wantSensitivities = _sensitiveParams.slices() > 0;
+		for (; (it != _solutionTimes.end()) && (*it <= t); ++it)
+		{
+			IDAGetDky(_idaMemBlock, *it, 0, _vecStateY);
+			IDAGetDky(_idaMemBlock, *it, 1, _vecStateYdot);
+			if (wantSensitivities)
+			{
+				IDAGetSensDky(_idaMemBlock, *it, 0, _vecFwdYs);
+				IDAGetSensDky(_idaMemBlock, *it, 1, _vecFwdYsDot);
+			}
+
+			writeSolution(*it);
+		}
+
+		// Keep state at the last solution time, which is the end of the time integration
+		if (it == _solutionTimes.end())
+			return;
+
+		// Restore state at time t
+		IDAGetDky(_idaMemBlock, t, 0, _vecStateY);
+		IDAGetDky(_idaMemBlock, t, 1, _vecStateYdot);
+		if (wantSensitivities)
+		{
+			IDAGetSensDky(_idaMemBlock, t, 0, _vecFwdYs);
+			IDAGetSensDky(_idaMemBlock, t, 1, _vecFwdYsDot);
+		}
+	}
+
+	void Simulator::writeCheckpoint(double t)
+	{
+		const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		const std::chrono::duration<double> elapsed = now - _lastCheckpoint;
+		if (elapsed.count() < _checkpointInterval)
+			return;
+
+		_lastCheckpoint = now;
+
+		const std::uint32_t nDof = NVEC_LENGTH(_vecStateY);
+		const std::uint32_t nSens = _sensitiveParams.slices();
+		const std::uint32_t secIdx = _curSec;
+
+		// Write to a temporary file first and replace the previous checkpoint afterwards,
+		// such that a complete checkpoint is available if the process is killed while writing
+		const std::string tempFile = _checkpointFile + ".tmp";
+		{
+			std::ofstream fs(tempFile, std::ios::out | std::ios::binary | std::ios::trunc);
+
+			fs.write(checkpointMagic, sizeof(checkpointMagic));
+			writeBinary(fs, checkpointVersion);
+			writeBinary(fs, secIdx);
+			writeBinary(fs, t);
+			writeBinary(fs, nDof);
+			writeBinary(fs, nSens);
+
+			fs.write(reinterpret_cast<const char*>(NVEC_DATA(_vecStateY)), nDof * sizeof(double));
+			fs.write(reinterpret_cast<const char*>(NVEC_DATA(_vecStateYdot)), nDof * sizeof(double));
+			for (unsigned int i = 0; i < nSens; ++i)
+			{
+				fs.write(reinterpret_cast<const char*>(NVEC_DATA(_vecFwdYs[i])), nDof * sizeof(double));
+				fs.write(reinterpret_cast<const char*>(NVEC_DATA(_vecFwdYsDot[i])), nDof * sizeof(double));
+			}
+
+			fs.close();
+			if (!fs)
+			{
+				// Do not abort the simulation, just skip this checkpoint
+				LOG(Warning) << "Failed to write checkpoint file " << tempFile;
+				return;
+			}
+		}
+
+#ifdef _WIN32
+		// Windows does not replace existing files on rename
+		std::remove(_checkpointFile.c_str());
+#endif
+		if (std::rename(tempFile.c_str(), _checkpointFile.c_str()) != 0)
+		{
+			LOG(Warning) << "Failed to replace checkpoint file " << _checkpointFile;
+			return;
+		}
+
+		LOG(Debug) << "Wrote checkpoint for section " << secIdx << " at t = " << t;
+	}
+
+	void Simulator::resumeFromCheckpoint(const char* fileName)
+	{
+		std::ifstream fs(fileName, std::ios::in | std::ios::binary);
+		if (!fs)
+			throw InvalidParameterException(std::string("Could not open checkpoint file ") + fileName);
+
+		char magic[sizeof(checkpointMagic)];
+		std::uint32_t version = 0;
+		std::uint32_t secIdx = 0;
+		double t = 0.0;
+		std::uint32_t nDof = 0;
+		std::uint32_t nSens = 0;
+
+		fs.read(magic, sizeof(magic));
+		readBinary(fs, version);
+		readBinary(fs, secIdx);
+		readBinary(fs, t);
+		readBinary(fs, nDof);
+		readBinary(fs, nSens);
+
+		if (!fs || !std::equal(magic, magic + sizeof(magic), checkpointMagic))
+			throw InvalidParameterException(std::string("File ") + fileName + " is not a valid checkpoint");
+		if (version != checkpointVersion)
+			throw InvalidParameterException("Checkpoint file version " + std::to_string(version) + " is not supported");
+		if (nDof != NVEC_LENGTH(_vecStateY))
+			throw InvalidParameterException("Checkpoint contains " + std::to_string(nDof) + " DOFs but model has " + std::to_string(NVEC_LENGTH(_vecStateY)));
+		if (nSens != _sensitiveParams.slices())
+			throw InvalidParameterException("Checkpoint contains " + std::to_string(nSens) + " sensitivities but " + std::to_string(_sensitiveParams.slices()) + " are configured");
+		if (secIdx >= _sectionTimes.size() - 1)
+			throw InvalidParameterException("Checkpoint section " + std::to_string(secIdx) + " exceeds number of sections " + std::to_string(_sectionTimes.size() - 1));
+
+		const double secStart = static_cast<double>(_sectionTimes[secIdx]);
+		if (std::abs(secStart - t) > 1e-12 * std::max(1.0, std::abs(secStart)))
+			throw InvalidParameterException("Checkpoint time " + std::to_string(t) + " does not match start time " + std::to_string(secStart) + " of section " + std::to_string(secIdx));
+
+		// Read into buffer to leave the current state intact in case of errors
+		std::vector<double> data(nDof * (2 + 2 * nSens));
+		fs.read(reinterpret_cast<char*>(data.data()), data.size() * sizeof(double));
+		if (!fs)
+			throw InvalidParameterException(std::string("Checkpoint file ") + fileName + " is truncated");
+
+		double const* ptr = data.data();
+		std::copy_n(ptr, nDof, NVEC_DATA(_vecStateY));
+		ptr += nDof;
+		std::copy_n(ptr, nDof, NVEC_DATA(_vecStateYdot));
+		ptr += nDof;
+		for (unsigned int i = 0; i < nSens; ++i)
+		{
+			std::copy_n(ptr, nDof, NVEC_DATA(_vecFwdYs[i]));
+			ptr += nDof;
+			std::copy_n(ptr, nDof, NVEC_DATA(_vecFwdYsDot[i]));
+			ptr += nDof;
+		}
+
+		_startSec = secIdx;
+
+		// The checkpoint was written before consistent initialization
+		_skipConsistencyStateY = false;
+		_skipConsistencySensitivity = false;
+
+		LOG(Debug) << "Resuming from checkpoint for section " << secIdx << " at t = " << t;
+	}
+
 	unsigned int Simulator::getNextSection(double t, unsigned int startIdx) const
 	{
 		if (t < _sectionTimes[startIdx])
@@ -1705,4 +2298,19 @@ namespace cadet
 		_notification = nc;
 	}
 
+	void Simulator::setEventHandler(IEventHandler* eh) CADET_NOEXCEPT
+	{
+		_eventHandler = eh;
+	}
+
+	bool Simulator::handleEvents(double t)
+	{
+		IDAGetRootInfo(_idaMemBlock, _eventsFound.data());
+
+		LOG(Debug) << "Event at t = " << t << " in section " << _curSec;
+
+		const SimulatorEventState state(*_model, NVEC_DATA(_vecStateY), NVEC_DATA(_vecStateYdot));
+		return _eventHandler->handleEvents(t, _curSec, _eventsFound.data(), state, *_model);
+	}
+
 } // namespace cadet
@@ -20,6 +20,9 @@
 
 #include <vector>
 #include <unordered_map>
+#include <string>
+#include <chrono>
+#include <exception>
 
 #include "SundialsVector.hpp"
 #include <idas/idas_impl.h>
@@ -28,6 +31,7 @@
 #include "AutoDiff.hpp"
 #include "SlicedVector.hpp"
 #include "common/Timer.hpp"
+#include "AllocationTracker.hpp"
 
 namespace cadet
 {
@@ -42,7 +46,10 @@ int residualSensWrapper(int ns, double t, N_Vector y, N_Vector yDot, N_Vector re
 
 //int weightWrapper(N_Vector y, N_Vector ewt, void *user_data);
 
+int rootFunctionWrapper(double t, N_Vector y, N_Vector yDot, double* gout, void* userData);
+
 class ISimulatableModel;
+class IEventHandler;
 
 /**
  * @brief Provides functionality to simulate a model using a time integrator
@@ -99,6 +106,10 @@ public:
 	virtual const std::vector<double const*> getLastSensitivities(unsigned int& len) const;
 	virtual const std::vector<double const*> getLastSensitivityDerivatives(unsigned int& len) const;
 
+	virtual void setCheckpointFile(const char* fileName);
+	virtual void setCheckpointInterval(double interval);
+	virtual void resumeFromCheckpoint(const char* fileName);
+
 	virtual void configure(IParameterProvider& paramProvider);
 	virtual void reconfigure(IParameterProvider& paramProvider);
 	virtual void configureTimeIntegrator(double relTol, double absTol, double initStepSize, unsigned int maxSteps, double maxStepSize);
@@ -119,6 +130,7 @@ public:
 	virtual void setMaxErrorTestFails(unsigned int nFails);
 	virtual void setMaxConvergenceFails(unsigned int nFails);
 	virtual void setMaxSensNewtonIteration(unsigned int nIter);
+	virtual void setSimultaneousSensitivityCorrector(bool simultaneous);
 
 	virtual bool reconfigureModel(IParameterProvider& paramProvider);
 	virtual bool reconfigureModel(IParameterProvider& paramProvider, unsigned int unitOpIdx);
@@ -132,7 +144,17 @@ public:
 	virtual double lastSimulationDuration() const CADET_NOEXCEPT { return _lastIntTime; }
 	virtual double totalSimulationDuration() const CADET_NOEXCEPT { return _timerIntegration.totalElapsedTime(); }
 
+	virtual void setSolverStatisticsRecording(bool enabled) CADET_NOEXCEPT { _recordStatistics = enabled; }
+	virtual const SolverStatistics& solverStatistics() const CADET_NOEXCEPT { return _statistics; }
+
 	virtual void setNotificationCallback(INotificationCallback* nc) CADET_NOEXCEPT;
+	virtual void setEventHandler(IEventHandler* eh) CADET_NOEXCEPT;
+
+#ifdef CADET_ALLOCATION_TRACKING
+	inline const util::AllocationStatistics& allocationsResidual() const CADET_NOEXCEPT { return _allocResidual; }
+	inline const util::AllocationStatistics& allocationsResidualSens() const CADET_NOEXCEPT { return _allocResidualSens; }
+	inline const util::AllocationStatistics& allocationsLinearSolve() const CADET_NOEXCEPT { return _allocLinearSolve; }
+#endif
 protected:
 
 	/**
@@ -146,6 +168,84 @@ protected:
 	 */
 	void writeSolution(double t);
 
+	/**
+	 * @brief Resets the recorded solver statistics and starts a new time series
+	 */
+	void beginSolverStatistics();
+
+	/**
+	 * @brief Appends an entry to the solver statistics at time point t
+	 * @param [in] t Current time point
+	 * @param [in] wantSensitivities Determines whether sensitivity counters are recorded
+	 */
+	void recordSolverStatistics(double t, bool wantSensitivities);
+
+	/**
+	 * @brief Integrates the sections starting from the given section until the end of the time span
+	 * @details Consistent initialization is performed and the time integrator is restarted at each
+	 *          discontinuous section transition.
+	 * @param [in] startSec Index of the first section
+	 * @param [in] record Determines whether solutions and checkpoints are written
+	 * @return @c true if the end of the time span has been reached, @c false if the user aborted the time integration
+	 */
+	bool integrateSections(unsigned int startSec, bool record);
+
+	/**
+	 * @brief Computes consistent initial values of the state and the sensitivities at time @p t
+	 * @details Respects the consistent initialization modes and resets the skip flags set by
+	 *          skipConsistentInitialization().
+	 * @param [in] t Current time point
+	 */
+	void computeConsistentInitialValues(double t);
+
+	/**
+	 * @brief Queries the fired events from the time integrator and passes them to the event handler
+	 * @param [in] t Time point of the event
+	 * @return @c true if the model has been modified by the event handler, otherwise @c false
+	 */
+	bool handleEvents(double t);
+
+	/**
+	 * @brief Iterates full cycles over all sections until the cyclic steady state is reached
+	 * @details One cycle maps the state and forward sensitivities at the beginning of the first
+	 *          section to those at the end of the last section. The fixed point of this map is
+	 *          computed by Anderson accelerated fixed-point iteration. On return, the current state
+	 *          holds the initial values of the final cycle.
+	 * @return @c true if the iteration has finished (converged or not), @c false if the user aborted the time integration
+	 */
+	bool solveCyclicSteadyState();
+
+	/**
+	 * @brief Copies the current state and forward sensitivities into a contiguous vector
+	 * @param [out] x Vector of size @c numDofs() * (1 + @c numSensParams())
+	 */
+	void gatherCycleState(double* const x) const;
+
+	/**
+	 * @brief Sets the current state and forward sensitivities from a contiguous vector
+	 * @details The time derivatives are recomputed by a full consistent initialization at the
+	 *          beginning of the first section.
+	 * @param [in] x Vector of size @c numDofs() * (1 + @c numSensParams())
+	 */
+	void scatterCycleState(double const* const x);
+
+	/**
+	 * @brief Writes the solution at all pending user specified solution times up to time point @p t
+	 * @details The solution is evaluated from the interpolating polynomial of the time integrator.
+	 *          On return, the state vectors hold the solution at time point @p t or, if all
+	 *          solution times have been written, at the last solution time.
+	 * @param [in] t Current time point of the time integrator
+	 * @param [in,out] it Iterator to the next pending solution time, advanced past all written time points
+	 */
+	void writeDenseOutput(double t, std::vector<double>::const_iterator& it);
+
+	/**
+	 * @brief Writes a checkpoint for a restart of the time integrator at the beginning of the current section
+	 * @details The checkpoint is skipped if the checkpoint interval has not elapsed since the last checkpoint.
+	 * @param [in] t Start time of the current section
+	 */
+	void writeCheckpoint(double t);
+
 	/**
 	 * @brief Computes the index of the next section from the given time @p t
 	 * @details Returns the lowest index @c i with @f$ t_i \geq t @f$, where 
@@ -223,6 +323,8 @@ protected:
 			N_Vector* yS, N_Vector* ySDot, N_Vector* resS,
 			void *userData, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3);
 
+	friend int ::cadet::rootFunctionWrapper(double t, N_Vector y, N_Vector yDot, double* gout, void* userData);
+
 	ISimulatableModel* _model; //!< Simulated model, not owned by the Simulator
 
 	ISolutionRecorder* _solRecorder;
@@ -263,8 +365,20 @@ protected:
 	unsigned int _maxErrorTestFail; //!< Maximum number of local time integration error test failures
 	unsigned int _maxConvTestFail; //!< Maximum number of Newton iteration failures
 	unsigned int _maxNewtonIterSens; //!< Maximum number of Newton iterations for forward sensitivity systems
+	bool _sensSimultaneous; //!< Determines whether forward sensitivity systems are corrected simultaneously with the original system (IDA_SIMULTANEOUS)
 
 	SectionIdx _curSec; //!< Index of the current section
+	unsigned int _startSec; //!< Index of the section in which the next time integration starts (see resumeFromCheckpoint())
+
+	std::string _checkpointFile; //!< Name of the checkpoint file, empty if checkpoints are disabled
+	double _checkpointInterval; //!< Minimum wall clock time in seconds between two checkpoints, 0 writes a checkpoint at every discontinuous section transition
+	std::chrono::steady_clock::time_point _lastCheckpoint; //!< Wall clock time of the last checkpoint
+
+	unsigned int _cssMaxCycles; //!< Maximum number of cycles in the cyclic steady state iteration, 0 disables the iteration
+	double _cssTol; //!< Tolerance of the cyclic steady state iteration
+	unsigned int _cssAndersonDepth; //!< Number of previous cycles used in the Anderson acceleration of the cyclic steady state iteration
+
+	bool _denseOutput; //!< Determines whether user specified solution times are interpolated after internal time steps instead of stopping the time integrator
 
 	bool _skipConsistencyStateY; //!< Flag that determines whether the consistent initialization is skipped
 	bool _skipConsistencySensitivity; //!< Flag that determines whether the consistent initialization of the sensitivity systems is skipped
@@ -275,10 +389,46 @@ protected:
 	active* _vecADres; //!< Vector of AD datatypes for holding the residual
 	active* _vecADy; //!< Vector of AD datatypes for holding the state vector
 
+	std::vector<const double*> _sensYPtrs; //!< Pointers to sensitivity state vectors passed to residualSensFwd() (avoids allocations in residualSensWrapper())
+	std::vector<const double*> _sensYdotPtrs; //!< Pointers to sensitivity state time derivative vectors passed to residualSensFwd()
+	std::vector<double*> _sensResPtrs; //!< Pointers to sensitivity residual vectors passed to residualSensFwd()
+
 	Timer _timerIntegration; //!< Timer measuring the duration of the call to integrate()
 	double _lastIntTime; //!< Last simulation duration
 
+	/**
+	 * @brief Accumulated counters of the time integrator
+	 */
+	struct IntegratorCounters
+	{
+		long numSteps;
+		long numResEvals;
+		long numNewtonIters;
+		long numConvFails;
+		long numErrTestFails;
+		long numSensResEvals;
+		long numSensNewtonIters;
+		long numSensConvFails;
+		long numSensErrTestFails;
+	};
+
+	bool _recordStatistics; //!< Determines whether solver statistics are recorded
+	SolverStatistics _statistics; //!< Recorded solver statistics
+	Timer _timerStatistics; //!< Timer measuring the wall-clock time between two statistics entries
+	IntegratorCounters _prevIntegratorCounters; //!< Time integrator counters at the previous statistics entry (IDAReInit() resets the counters)
+	std::vector<int> _prevFactorizations; //!< Number of factorizations of each unit operation at the previous statistics entry
+	std::vector<int> _prevGmresIterations; //!< Number of GMRES iterations of each unit operation at the previous statistics entry
+	int _prevCouplingGmresIterations; //!< Number of GMRES iterations of the unit operation coupling at the previous statistics entry
+
+	ALLOCATION_STATS(_allocResidual)
+	ALLOCATION_STATS(_allocResidualSens)
+	ALLOCATION_STATS(_allocLinearSolve)
+
 	INotificationCallback* _notification; //!< Callback handler for notifications
+
+	IEventHandler* _eventHandler; //!< Handler for state dependent events, not owned by the Simulator
+	std::vector<int> _eventsFound; //!< Flags indicating fired events (see IDAGetRootInfo())
+	std::exception_ptr _eventException; //!< Exception thrown by the event handler inside the IDAS root function, rethrown after IDASolve() returns
 };
 
 } // namespace cadet
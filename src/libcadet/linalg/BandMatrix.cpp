@@ -224,6 +224,11 @@ bool FactorizableBandMatrix::factorize()
 }
 
 bool FactorizableBandMatrix::solve(double* rhs) const
+{
+	return solve(rhs, 1);
+}
+
+bool FactorizableBandMatrix::solve(double* rhs, unsigned int nRhs) const
 {
 	// Since LAPACK uses column-major storage and we use row-major,
 	// we actually have constructed the transposed matrix. Thus,
@@ -231,7 +236,7 @@ bool FactorizableBandMatrix::solve(double* rhs) const
 	lapackInt_t n = _rows;
 	lapackInt_t kl = _upperBand;
 	lapackInt_t ku = _lowerBand;
-	lapackInt_t nrhs = 1;
+	lapackInt_t nrhs = nRhs;
 	lapackInt_t ldab = stride();
 	lapackInt_t flag = 0;
 
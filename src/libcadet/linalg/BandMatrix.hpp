@@ -1336,6 +1336,17 @@ public:
 	 */
 	bool solve(double* rhs) const;
 
+	/**
+	 * @brief Uses the factorized matrix to solve the equation @f$ AX = B @f$ for multiple right hand sides with LAPACK
+	 * @details Before the equation can be solved, the matrix has to be factorized first by calling factorize().
+	 *          The right hand sides are stored consecutively, that is, the @c i th right hand side starts
+	 *          at @c rhs + @c i * rows(). All right hand sides are solved in one LAPACK call.
+	 * @param [in,out] rhs On entry pointer to the right hand side vectors @f$ B @f$ of the equation, on exit the solutions @f$ X @f$
+	 * @param [in] nRhs Number of right hand sides
+	 * @return @c true if the solution process was successful, otherwise @c false
+	 */
+	bool solve(double* rhs, unsigned int nRhs) const;
+
 	/**
 	 * @brief Uses the factorized matrix to solve the equation @f$ Ax = b @f$ with LAPACK
 	 * @details Before the equation can be solved, the matrix has to be factorized first by calling factorize().
@@ -187,13 +187,12 @@ public:
 	 */
 	const char* getReturnFlagName(int flag) const CADET_NOEXCEPT;
 
-#ifdef CADET_BENCHMARK_MODE
 	/**
 	 * @brief Returns the total number of iterations over all calls of solve()
+	 * @details Iterations are counted as matrix-vector products.
 	 * @return Total number of iterations
 	 */
 	inline int numIterations() const CADET_NOEXCEPT { return _numIter; }
-#endif
 
 protected:
 
@@ -208,10 +207,8 @@ protected:
 	MatrixVectorMultFun _matVecMul; //!< Matrix-vector multiplication function required for GMRES algorithm
 	void* _userData; //!< User data for matrix-vector multiplication function
 
-#ifdef CADET_BENCHMARK_MODE
 	int _numIter; //!< Accumulated number of iterations
 	friend int gmresCallback(void* userData, N_Vector v, N_Vector z);
-#endif
 };
 
 } // namespace linalg
@@ -1117,89 +1117,113 @@ void GeneralRateModel::consistentInitialSensitivity(const SimulationTime& simTim
 		multiplyWithJacobian(simTime, simState, sensY, -1.0, 1.0, sensYdot);
 
 		// Note that we have correctly negated the right hand side
+	}
 
-		// Handle bulk block
-		_convDispOp.solveTimeDerivativeSystem(simTime, sensYdot + idxr.offsetC());
+	// The matrices of step 2 do not depend on the parameter. Hence, they are assembled and
+	// factorized only once (step 1 uses the memory of _jacPdisc as scratch space) and then
+	// applied to all right hand sides
 
-		// Process the particle blocks
+	// Handle bulk block
+	_convDispOp.solveTimeDerivativeSystem(simTime, vecSensYdot.data(), vecSensYdot.size(), idxr.offsetC());
+
+	// Process the particle blocks
 #ifdef CADET_PARALLELIZE
-		BENCH_START(_timerConsistentInitPar);
-		tbb::parallel_for(size_t(0), size_t(_disc.nCol * _disc.nParType), [&](size_t pblk)
+	BENCH_START(_timerConsistentInitPar);
+	tbb::parallel_for(size_t(0), size_t(_disc.nCol * _disc.nParType), [&](size_t pblk)
 #else
-		for (unsigned int pblk = 0; pblk < _disc.nCol * _disc.nParType; ++pblk)
+	for (unsigned int pblk = 0; pblk < _disc.nCol * _disc.nParType; ++pblk)
 #endif
-		{
-			const unsigned int type = pblk / _disc.nCol;
-			const unsigned int par = pblk % _disc.nCol;
+	{
+		const unsigned int type = pblk / _disc.nCol;
+		const unsigned int par = pblk % _disc.nCol;
 
-			// Assemble
-			linalg::FactorizableBandMatrix& fbm = _jacPdisc[pblk];
-			fbm.setAll(0.0);
+		// Assemble
+		linalg::FactorizableBandMatrix& fbm = _jacPdisc[pblk];
+		fbm.setAll(0.0);
 
-			linalg::FactorizableBandMatrix::RowIterator jac = fbm.row(0);
-			for (unsigned int j = 0; j < _disc.nParCell[type]; ++j)
+		linalg::FactorizableBandMatrix::RowIterator jac = fbm.row(0);
+		for (unsigned int j = 0; j < _disc.nParCell[type]; ++j)
+		{
+			// Populate matrix with time derivative Jacobian first
+			addTimeDerivativeToJacobianParticleShell(jac, idxr, 1.0, type);
+			// Iterator jac has already been advanced to next shell
+
+			// Overwrite rows corresponding to algebraic equations with the Jacobian
+			if (_binding[type]->hasQuasiStationaryReactions())
 			{
-				// Populate matrix with time derivative Jacobian first
-				addTimeDerivativeToJacobianParticleShell(jac, idxr, 1.0, type);
-				// Iterator jac has already been advanced to next shell
+				// Get iterators to beginning of solid phase
+				linalg::BandMatrix::RowIterator jacSolidOrig = _jacP[pblk].row(j * static_cast<unsigned int>(idxr.strideParShell(type)) + static_cast<unsigned int>(idxr.strideParLiquid()));
+				linalg::FactorizableBandMatrix::RowIterator jacSolid = jac - idxr.strideParBound(type);
+
+				int const* const mask = _binding[type]->reactionQuasiStationarity();
 
-				// Overwrite rows corresponding to algebraic equations with the Jacobian and set right hand side to 0
-				if (_binding[type]->hasQuasiStationaryReactions())
+				// Copy row from original Jacobian
+				for (int i = 0; i < idxr.strideParBound(type); ++i, ++jacSolid, ++jacSolidOrig)
 				{
-					// Get iterators to beginning of solid phase
-					linalg::BandMatrix::RowIterator jacSolidOrig = _jacP[pblk].row(j * static_cast<unsigned int>(idxr.strideParShell(type)) + static_cast<unsigned int>(idxr.strideParLiquid()));
-					linalg::FactorizableBandMatrix::RowIterator jacSolid = jac - idxr.strideParBound(type);
+					if (!mask[i])
+						continue;
+
+					jacSolid.copyRowFrom(jacSolidOrig);
+				}
+			}
+		}
+
+		// Precondition
+		double* const scaleFactors = _tempState + idxr.offsetCp(ParticleTypeIndex{type}, ParticleIndex{par});
+		fbm.rowScaleFactors(scaleFactors);
+		fbm.scaleRows(scaleFactors);
+
+		// Factorize
+		const bool result = fbm.factorize();
+		if (!result)
+		{
+			LOG(Error) << "Factorize() failed for par block " << pblk << " (type " << type << " col " << par << ")";
+		}
 
-					int const* const mask = _binding[type]->reactionQuasiStationarity();
-					double* const qShellDot = sensYdot + idxr.offsetCp(ParticleTypeIndex{type}, ParticleIndex{par}) + static_cast<int>(j) * idxr.strideParShell(type) + idxr.strideParLiquid();
+		for (unsigned int param = 0; param < vecSensYdot.size(); ++param)
+		{
+			double* const parYdot = vecSensYdot[param] + idxr.offsetCp(ParticleTypeIndex{type}, ParticleIndex{par});
 
-					// Copy row from original Jacobian and set right hand side
-					for (int i = 0; i < idxr.strideParBound(type); ++i, ++jacSolid, ++jacSolidOrig)
+			// Set right hand side of algebraic equations to 0
+			if (_binding[type]->hasQuasiStationaryReactions())
+			{
+				int const* const mask = _binding[type]->reactionQuasiStationarity();
+				for (unsigned int j = 0; j < _disc.nParCell[type]; ++j)
+				{
+					double* const qShellDot = parYdot + static_cast<int>(j) * idxr.strideParShell(type) + idxr.strideParLiquid();
+					for (int i = 0; i < idxr.strideParBound(type); ++i)
 					{
 						if (!mask[i])
 							continue;
 
-						jacSolid.copyRowFrom(jacSolidOrig);
-
 						// Right hand side is -\frac{\partial^2 res(t, y, \dot{y})}{\partial p \partial t}
 						// If the residual is not explicitly depending on time, this expression is 0
 						// @todo This is wrong if external functions are used. Take that into account!
 						qShellDot[i] = 0.0;
 					}
 				}
-			}   
-
-			// Precondition
-			double* const scaleFactors = _tempState + idxr.offsetCp(ParticleTypeIndex{type}, ParticleIndex{par});
-			fbm.rowScaleFactors(scaleFactors);
-			fbm.scaleRows(scaleFactors);
-
-			// Factorize
-			const bool result = fbm.factorize();
-			if (!result)
-			{
-				LOG(Error) << "Factorize() failed for par block " << pblk << " (type " << type << " col " << par << ")";
 			}
 
 			// Solve
-			const bool result2 = fbm.solve(scaleFactors, sensYdot + idxr.offsetCp(ParticleTypeIndex{type}, ParticleIndex{par}));
+			const bool result2 = fbm.solve(scaleFactors, parYdot);
 			if (!result2)
 			{
 				LOG(Error) << "Solve() failed for par block " << pblk << " (type " << type << " col " << par << ")";
 			}
-		} CADET_PARFOR_END;
+		}
+	} CADET_PARFOR_END;
 
 #ifdef CADET_PARALLELIZE
-		BENCH_STOP(_timerConsistentInitPar);
+	BENCH_STOP(_timerConsistentInitPar);
 #endif
 
-		// TODO: Right hand side for fluxes should be -d^2res/(dp dy) * \dot{y}
-		// If parameters depend on time, then it should be
-		// -d^2res/(dp dy) * \dot{y} - d^2res/(dt dy) * s - d^2res/(dp dt)
+	// TODO: Right hand side for fluxes should be -d^2res/(dp dy) * \dot{y}
+	// If parameters depend on time, then it should be
+	// -d^2res/(dp dy) * \dot{y} - d^2res/(dt dy) * s - d^2res/(dp dt)
 
-		// Step 2b: Solve for fluxes j_f by backward substitution
-		solveForFluxes(sensYdot, idxr);
-	}
+	// Step 2b: Solve for fluxes j_f by backward substitution
+	for (unsigned int param = 0; param < vecSensYdot.size(); ++param)
+		solveForFluxes(vecSensYdot[param], idxr);
 }
 
 /**
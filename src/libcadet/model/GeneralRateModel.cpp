@@ -39,6 +39,7 @@
 #include <algorithm>
 #include <functional>
 #include <numeric>
+#include <type_traits>
 #include <iterator>
 
 #include "ParallelSupport.hpp"
@@ -66,7 +67,7 @@ int schurComplementMultiplierGRM(void* userData, double const* x, double* z)
 GeneralRateModel::GeneralRateModel(UnitOpIdx unitOpIdx) : UnitOperationBase(unitOpIdx),
 	_hasSurfaceDiffusion(0, false), _dynReactionBulk(nullptr),
 	_jacP(nullptr), _jacPdisc(nullptr), _jacPF(nullptr), _jacFP(nullptr), _jacInlet(),
-	_analyticJac(true), _jacobianAdDirs(0), _factorizeJacobian(false), _tempState(nullptr),
+	_analyticJac(true), _jacobianAdDirs(0), _factorizeJacobian(false), _numFactorizations(0), _tempState(nullptr),
 	_initC(0), _initCp(0), _initQ(0), _initState(0), _initStateDot(0)
 {
 }
@@ -920,6 +921,8 @@ int GeneralRateModel::residual(const SimulationTime& simTime, const ConstSimulat
 {
 	if (updateJacobian)
 	{
+		BENCH_SCOPE(_timerJacobianPar);
+
 		_factorizeJacobian = true;
 
 #ifndef CADET_CHECK_ANALYTIC_JACOBIAN
@@ -1023,18 +1026,27 @@ int GeneralRateModel::residualImpl(double t, unsigned int secIdx, StateType cons
 	BENCH_START(_timerResidualPar);
 
 #ifdef CADET_PARALLELIZE
-	tbb::parallel_for(size_t(0), size_t(_disc.nCol * _disc.nParType + 1), [&](size_t pblk)
-#else
-	for (unsigned int pblk = 0; pblk < _disc.nCol * _disc.nParType + 1; ++pblk)
+	tbb::parallel_for(tbb::blocked_range<size_t>(0, _disc.nCol * _disc.nParType + 1), [&](const tbb::blocked_range<size_t>& r)
 #endif
 	{
-		if (cadet_unlikely(pblk == 0))
-			residualBulk<StateType, ResidualType, ParamType, wantJac>(t, secIdx, y, yDot, res, threadLocalMem);
-		else
+		// Passes that assemble the Jacobian analytically or via AD are counted separately,
+		// counters are read once per chunk of blocks instead of once per block
+		BENCH_COUNTER_SCOPE_SELECT((wantJac || std::is_same<StateType, active>::value), _countersJacobianPar, _countersResidualPar);
+
+#ifdef CADET_PARALLELIZE
+		for (size_t pblk = r.begin(); pblk != r.end(); ++pblk)
+#else
+		for (unsigned int pblk = 0; pblk < _disc.nCol * _disc.nParType + 1; ++pblk)
+#endif
 		{
-			const unsigned int type = (pblk - 1) / _disc.nCol;
-			const unsigned int par = (pblk - 1) % _disc.nCol;
-			residualParticle<StateType, ResidualType, ParamType, wantJac>(t, type, par, secIdx, y, yDot, res, threadLocalMem);
+			if (cadet_unlikely(pblk == 0))
+				residualBulk<StateType, ResidualType, ParamType, wantJac>(t, secIdx, y, yDot, res, threadLocalMem);
+			else
+			{
+				const unsigned int type = (pblk - 1) / _disc.nCol;
+				const unsigned int par = (pblk - 1) % _disc.nCol;
+				residualParticle<StateType, ResidualType, ParamType, wantJac>(t, type, par, secIdx, y, yDot, res, threadLocalMem);
+			}
 		}
 	} CADET_PARFOR_END;
 
@@ -1619,34 +1631,31 @@ int GeneralRateModel::residualSensFwdCombine(const SimulationTime& simTime, cons
 {
 	BENCH_SCOPE(_timerResidualSens);
 
-	// tmp1 stores result of (dF / dy) * s
-	// tmp2 stores result of (dF / dyDot) * sDot
+	// Each sensitivity residual is accumulated directly in resS instead of the shared temporaries
+	// tmp1 and tmp2. Hence, the parameters are independent and can be processed in parallel.
+
+	BENCH_START(_timerResidualSensPar);
 
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(size_t(0), yS.size(), [&](size_t param)
+#else
 	for (unsigned int param = 0; param < yS.size(); ++param)
+#endif
 	{
-		// Directional derivative (dF / dy) * s
-		multiplyWithJacobian(SimulationTime{0.0, 0u}, ConstSimulationState{nullptr, nullptr}, yS[param], 1.0, 0.0, tmp1);
+		double* const ptrResS = resS[param];
 
 		// Directional derivative (dF / dyDot) * sDot
-		multiplyWithDerivativeJacobian(SimulationTime{0.0, 0u}, ConstSimulationState{nullptr, nullptr}, ySdot[param], tmp2);
+		multiplyWithDerivativeJacobian(SimulationTime{0.0, 0u}, ConstSimulationState{nullptr, nullptr}, ySdot[param], ptrResS);
 
-		double* const ptrResS = resS[param];
-
-		BENCH_START(_timerResidualSensPar);
+		// Add directional derivative (dF / dy) * s
+		multiplyWithJacobian(SimulationTime{0.0, 0u}, ConstSimulationState{nullptr, nullptr}, yS[param], 1.0, 1.0, ptrResS);
 
-		// Complete sens residual is the sum:
-		// TODO: Chunk TBB loop
-#ifdef CADET_PARALLELIZE
-		tbb::parallel_for(size_t(0), size_t(numDofs()), [&](size_t i)
-#else
+		// Complete sens residual is the sum
 		for (unsigned int i = 0; i < numDofs(); ++i)
-#endif
-		{
-			ptrResS[i] = tmp1[i] + tmp2[i] + adRes[i].getADValue(param);
-		} CADET_PARFOR_END;
+			ptrResS[i] += adRes[i].getADValue(param);
+	} CADET_PARFOR_END;
 
-		BENCH_STOP(_timerResidualSensPar);
-	}
+	BENCH_STOP(_timerResidualSensPar);
 
 	return 0;
 }
@@ -118,6 +118,8 @@ int GeneralRateModel2D::linearSolve(double t, double alpha, double outerTol, dou
 	// ==== Step 1: Factorize diagonal Jacobian blocks
 
 	// Factorize partial Jacobians only if required
+	if (_factorizeJacobian)
+		++_numFactorizations;
 
 #ifdef CADET_PARALLELIZE
 	tbb::flow::graph g;
@@ -130,6 +132,8 @@ int GeneralRateModel2D::linearSolve(double t, double alpha, double outerTol, dou
 		node_t A(g, [&](msg_t)
 #endif
 		{
+			BENCH_SCOPE(_timerFactorize);
+
 			// Assemble and factorize discretized bulk Jacobian
 			const bool result = _convDispOp.assembleAndFactorizeDiscretizedJacobian(alpha);
 			if (cadet_unlikely(!result))
@@ -144,23 +148,31 @@ int GeneralRateModel2D::linearSolve(double t, double alpha, double outerTol, dou
 #endif
 		{
 #ifdef CADET_PARALLELIZE
-			tbb::parallel_for(size_t(0), size_t(_disc.nCol * _disc.nRad * _disc.nParType), [&](size_t pblk)
-#else
-			for (unsigned int pblk = 0; pblk < _disc.nCol * _disc.nRad * _disc.nParType; ++pblk)
+			tbb::parallel_for(tbb::blocked_range<size_t>(0, _disc.nCol * _disc.nRad * _disc.nParType), [&](const tbb::blocked_range<size_t>& r)
 #endif
 			{
-				const unsigned int type = pblk / (_disc.nCol * _disc.nRad);
-				const unsigned int par = pblk % (_disc.nCol * _disc.nRad);
+				// Counters are read once per chunk of blocks instead of once per block
+				BENCH_COUNTER_SCOPE(_countersFactorizePar);
 
-				// Assemble
-				assembleDiscretizedJacobianParticleBlock(type, par, alpha, idxr);
-
-				// Factorize
-				const bool result = _jacPdisc[pblk].factorize();
-				if (cadet_unlikely(!result))
+#ifdef CADET_PARALLELIZE
+				for (size_t pblk = r.begin(); pblk != r.end(); ++pblk)
+#else
+				for (unsigned int pblk = 0; pblk < _disc.nCol * _disc.nRad * _disc.nParType; ++pblk)
+#endif
 				{
+					const unsigned int type = pblk / (_disc.nCol * _disc.nRad);
+					const unsigned int par = pblk % (_disc.nCol * _disc.nRad);
+
+					// Assemble
+					assembleDiscretizedJacobianParticleBlock(type, par, alpha, idxr);
+
+					// Factorize
+					const bool result = _jacPdisc[pblk].factorize();
+					if (cadet_unlikely(!result))
 					{
-						LOG(Error) << "Factorize() failed for par block " << pblk;
+						{
+							LOG(Error) << "Factorize() failed for par block " << pblk;
+						}
 					}
 				}
 			} CADET_PARFOR_END;
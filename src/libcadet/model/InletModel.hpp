@@ -138,6 +138,7 @@ public:
 	virtual void expandErrorTol(double const* errorSpec, unsigned int errorSpecSize, double* expandOut) { }
 
 	virtual unsigned int threadLocalMemorySize() const CADET_NOEXCEPT { return 0; }
+	virtual LinearSolverStatistics linearSolverStatistics() const CADET_NOEXCEPT { return LinearSolverStatistics{0, 0}; }
 
 #ifdef CADET_BENCHMARK_MODE
 	virtual std::vector<double> benchmarkTimings() const { return std::vector<double>(0); }
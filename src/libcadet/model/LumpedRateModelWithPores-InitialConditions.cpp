@@ -1062,46 +1062,81 @@ void LumpedRateModelWithPores::consistentInitialSensitivity(const SimulationTime
 		multiplyWithJacobian(simTime, simState, sensY, -1.0, 1.0, sensYdot);
 
 		// Note that we have correctly negated the right hand side
+	}
 
-		// Handle bulk block
-		_convDispOp.solveTimeDerivativeSystem(simTime, sensYdot + idxr.offsetC());
+	// The matrices of step 2 do not depend on the parameter. Hence, they are assembled and
+	// factorized only once (step 1 uses the memory of _jacPdisc as scratch space) and then
+	// applied to all right hand sides
 
-		// Process the particle blocks
+	// Handle bulk block
+	_convDispOp.solveTimeDerivativeSystem(simTime, vecSensYdot.data(), vecSensYdot.size(), idxr.offsetC());
+
+	// Process the particle blocks
 #ifdef CADET_PARALLELIZE
-		BENCH_START(_timerConsistentInitPar);
-		tbb::parallel_for(size_t(0), size_t(_disc.nParType), [&](size_t type)
+	BENCH_START(_timerConsistentInitPar);
+	tbb::parallel_for(size_t(0), size_t(_disc.nParType), [&](size_t type)
 #else
-		for (unsigned int type = 0; type < _disc.nParType; ++type)
+	for (unsigned int type = 0; type < _disc.nParType; ++type)
 #endif
+	{
+		_jacPdisc[type].setAll(0.0);
+		for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
 		{
-			_jacPdisc[type].setAll(0.0);
-			for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
+			// Assemble
+			linalg::FactorizableBandMatrix::RowIterator jac = _jacPdisc[type].row(idxr.strideParBlock(type) * pblk);
+
+			// Mobile and solid phase
+			addTimeDerivativeToJacobianParticleBlock(jac, idxr, 1.0, type);
+			// Iterator jac has already been advanced to next shell
+
+			// Overwrite rows corresponding to algebraic equations with the Jacobian
+			if (_binding[type]->hasQuasiStationaryReactions())
 			{
-				// Assemble
-				linalg::FactorizableBandMatrix::RowIterator jac = _jacPdisc[type].row(idxr.strideParBlock(type) * pblk);
+				// Get iterators to beginning of solid phase
+				linalg::BandMatrix::RowIterator jacSolidOrig = _jacP[type].row(idxr.strideParBlock(type) * pblk + static_cast<unsigned int>(idxr.strideParLiquid()));
+				linalg::FactorizableBandMatrix::RowIterator jacSolid = jac - idxr.strideParBound(type);
 
-				// Mobile and solid phase
-				addTimeDerivativeToJacobianParticleBlock(jac, idxr, 1.0, type);
-				// Iterator jac has already been advanced to next shell
+				int const* const mask = _binding[type]->reactionQuasiStationarity();
 
-				// Overwrite rows corresponding to algebraic equations with the Jacobian and set right hand side to 0
-				if (_binding[type]->hasQuasiStationaryReactions())
+				// Copy row from original Jacobian
+				for (int i = 0; i < idxr.strideParBound(type); ++i, ++jacSolid, ++jacSolidOrig)
 				{
-					// Get iterators to beginning of solid phase
-					linalg::BandMatrix::RowIterator jacSolidOrig = _jacP[type].row(idxr.strideParBlock(type) * pblk + static_cast<unsigned int>(idxr.strideParLiquid()));
-					linalg::FactorizableBandMatrix::RowIterator jacSolid = jac - idxr.strideParBound(type);
+					if (!mask[i])
+						continue;
 
-					int const* const mask = _binding[type]->reactionQuasiStationarity();
-					double* const qShellDot = sensYdot + idxr.offsetCp(ParticleTypeIndex{static_cast<unsigned int>(type)}, ParticleIndex{pblk}) + idxr.strideParLiquid();
+					jacSolid.copyRowFrom(jacSolidOrig);
+				}
+			}
+		}
 
-					// Copy row from original Jacobian and set right hand side
-					for (int i = 0; i < idxr.strideParBound(type); ++i, ++jacSolid, ++jacSolidOrig)
+		// Precondition
+		double* const scaleFactors = _tempState + idxr.offsetCp(ParticleTypeIndex{static_cast<unsigned int>(type)});
+		_jacPdisc[type].rowScaleFactors(scaleFactors);
+		_jacPdisc[type].scaleRows(scaleFactors);
+
+		// Factorize
+		const bool result = _jacPdisc[type].factorize();
+		if (!result)
+		{
+			LOG(Error) << "Factorize() failed for par type block " << type;
+		}
+
+		for (unsigned int param = 0; param < vecSensYdot.size(); ++param)
+		{
+			double* const parYdot = vecSensYdot[param] + idxr.offsetCp(ParticleTypeIndex{static_cast<unsigned int>(type)});
+
+			// Set right hand side of algebraic equations to 0
+			if (_binding[type]->hasQuasiStationaryReactions())
+			{
+				int const* const mask = _binding[type]->reactionQuasiStationarity();
+				for (unsigned int pblk = 0; pblk < _disc.nCol; ++pblk)
+				{
+					double* const qShellDot = parYdot + idxr.strideParBlock(type) * pblk + idxr.strideParLiquid();
+					for (int i = 0; i < idxr.strideParBound(type); ++i)
 					{
 						if (!mask[i])
 							continue;
 
-						jacSolid.copyRowFrom(jacSolidOrig);
-
 						// Right hand side is -\frac{\partial^2 res(t, y, \dot{y})}{\partial p \partial t}
 						// If the residual is not explicitly depending on time, this expression is 0
 						// @todo This is wrong if external functions are used. Take that into account!
@@ -1110,37 +1145,26 @@ void LumpedRateModelWithPores::consistentInitialSensitivity(const SimulationTime
 				}
 			}
 
-			// Precondition
-			double* const scaleFactors = _tempState + idxr.offsetCp(ParticleTypeIndex{static_cast<unsigned int>(type)});
-			_jacPdisc[type].rowScaleFactors(scaleFactors);
-			_jacPdisc[type].scaleRows(scaleFactors);
-
-			// Factorize
-			const bool result = _jacPdisc[type].factorize();
-			if (!result)
-			{
-				LOG(Error) << "Factorize() failed for par type block " << type;
-			}
-
 			// Solve
-			const bool result2 = _jacPdisc[type].solve(scaleFactors, sensYdot + idxr.offsetCp(ParticleTypeIndex{static_cast<unsigned int>(type)}));
+			const bool result2 = _jacPdisc[type].solve(scaleFactors, parYdot);
 			if (!result2)
 			{
 				LOG(Error) << "Solve() failed for par type block " << type;
 			}
-		} CADET_PARFOR_END;
+		}
+	} CADET_PARFOR_END;
 
 #ifdef CADET_PARALLELIZE
-		BENCH_STOP(_timerConsistentInitPar);
+	BENCH_STOP(_timerConsistentInitPar);
 #endif
 
-		// TODO: Right hand side for fluxes should be -d^2res/(dp dy) * \dot{y}
-		// If parameters depend on time, then it should be
-		// -d^2res/(dp dy) * \dot{y} - d^2res/(dt dy) * s - d^2res/(dp dt)
+	// TODO: Right hand side for fluxes should be -d^2res/(dp dy) * \dot{y}
+	// If parameters depend on time, then it should be
+	// -d^2res/(dp dy) * \dot{y} - d^2res/(dt dy) * s - d^2res/(dp dt)
 
-		// Step 2b: Solve for fluxes j_f by backward substitution
-		solveForFluxes(sensYdot, idxr);
-	}
+	// Step 2b: Solve for fluxes j_f by backward substitution
+	for (unsigned int param = 0; param < vecSensYdot.size(); ++param)
+		solveForFluxes(vecSensYdot[param], idxr);
 }
 
 /**
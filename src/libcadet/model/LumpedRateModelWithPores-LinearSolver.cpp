@@ -117,6 +117,8 @@ int LumpedRateModelWithPores::linearSolve(double t, double alpha, double outerTo
 	// ==== Step 1: Factorize diagonal Jacobian blocks
 
 	// Factorize partial Jacobians only if required
+	if (_factorizeJacobian)
+		++_numFactorizations;
 
 #ifdef CADET_PARALLELIZE
 	tbb::flow::graph g;
@@ -129,6 +131,8 @@ int LumpedRateModelWithPores::linearSolve(double t, double alpha, double outerTo
 		node_t A(g, [&](msg_t)
 #endif
 		{
+			BENCH_SCOPE(_timerFactorize);
+
 			// Assemble and factorize discretized bulk Jacobian
 			const bool result = _convDispOp.assembleAndFactorizeDiscretizedJacobian(alpha);
 			if (cadet_unlikely(!result))
@@ -143,19 +147,27 @@ int LumpedRateModelWithPores::linearSolve(double t, double alpha, double outerTo
 #endif
 		{
 #ifdef CADET_PARALLELIZE
-			tbb::parallel_for(size_t(0), size_t(_disc.nParType), [&](size_t type)
-#else
-			for (unsigned int type = 0; type < _disc.nParType; ++type)
+			tbb::parallel_for(tbb::blocked_range<size_t>(0, _disc.nParType), [&](const tbb::blocked_range<size_t>& r)
 #endif
 			{
-				// Assemble
-				assembleDiscretizedJacobianParticleBlock(type, alpha, idxr);
+				// Counters are read once per chunk of blocks instead of once per block
+				BENCH_COUNTER_SCOPE(_countersFactorizePar);
 
-				// Factorize
-				const bool result = _jacPdisc[type].factorize();
-				if (cadet_unlikely(!result))
+#ifdef CADET_PARALLELIZE
+				for (size_t type = r.begin(); type != r.end(); ++type)
+#else
+				for (unsigned int type = 0; type < _disc.nParType; ++type)
+#endif
 				{
-					LOG(Error) << "Factorize() failed for par type block " << type;
+					// Assemble
+					assembleDiscretizedJacobianParticleBlock(type, alpha, idxr);
+
+					// Factorize
+					const bool result = _jacPdisc[type].factorize();
+					if (cadet_unlikely(!result))
+					{
+						LOG(Error) << "Factorize() failed for par type block " << type;
+					}
 				}
 			} CADET_PARFOR_END;
 		} CADET_PARNODE_END;
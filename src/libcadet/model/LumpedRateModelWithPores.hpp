@@ -150,6 +150,7 @@ public:
 	virtual void setSensitiveParameterValue(const ParameterId& id, double value);
 
 	virtual unsigned int threadLocalMemorySize() const CADET_NOEXCEPT;
+	virtual LinearSolverStatistics linearSolverStatistics() const CADET_NOEXCEPT { return LinearSolverStatistics{_numFactorizations, _gmres.numIterations()}; }
 
 #ifdef CADET_BENCHMARK_MODE
 	virtual std::vector<double> benchmarkTimings() const
@@ -168,6 +169,13 @@ public:
 			_timerFactorizePar.totalElapsedTime(),
 			_timerMatVec.totalElapsedTime(),
 			_timerGmres.totalElapsedTime()
+			BENCH_COUNTERS(_timerResidual.counters())
+			BENCH_COUNTERS(_countersResidualPar)
+			BENCH_COUNTERS(_countersJacobianPar)
+			BENCH_COUNTERS(_timerFactorize.counters())
+			BENCH_COUNTERS(_countersFactorizePar)
+			BENCH_COUNTERS(_timerGmres.counters())
+			BENCH_COUNTERS(_timerConsistentInit.counters())
 		});
 	}
 
@@ -187,6 +195,13 @@ public:
 			"FactorizePar",
 			"MatVec",
 			"Gmres"
+			BENCH_COUNTER_DESC("Residual")
+			BENCH_COUNTER_DESC("ResidualPar")
+			BENCH_COUNTER_DESC("JacobianPar")
+			BENCH_COUNTER_DESC("Factorize")
+			BENCH_COUNTER_DESC("FactorizePar")
+			BENCH_COUNTER_DESC("Gmres")
+			BENCH_COUNTER_DESC("ConsistentInit")
 		};
 		return desc;
 	}
@@ -275,6 +290,7 @@ protected:
 	unsigned int _jacobianAdDirs; //!< Number of AD seed vectors required for Jacobian computation
 
 	bool _factorizeJacobian; //!< Determines whether the Jacobian needs to be factorized
+	int _numFactorizations; //!< Number of Jacobian factorizations in linearSolve()
 	double* _tempState; //!< Temporary storage with the size of the state vector or larger if binding models require it
 	linalg::Gmres _gmres; //!< GMRES algorithm for the Schur-complement in linearSolve()
 	double _schurSafety; //!< Safety factor for Schur-complement solution
@@ -297,6 +313,9 @@ protected:
 	BENCH_TIMER(_timerFactorizePar)
 	BENCH_TIMER(_timerMatVec)
 	BENCH_TIMER(_timerGmres)
+	BENCH_COUNTER(_countersResidualPar)
+	BENCH_COUNTER(_countersJacobianPar)
+	BENCH_COUNTER(_countersFactorizePar)
 
 	// Wrapper for calling the corresponding function in GeneralRateModel class
 	friend int schurComplementMultiplierLRMPores(void* userData, double const* x, double* z);
@@ -34,6 +34,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <atomic>
 
 #include "ParallelSupport.hpp"
 #ifdef CADET_PARALLELIZE
@@ -91,7 +92,7 @@ namespace model
 {
 
 LumpedRateModelWithoutPores::LumpedRateModelWithoutPores(UnitOpIdx unitOpIdx) : UnitOperationBase(unitOpIdx),
-	_jacInlet(), _analyticJac(true), _jacobianAdDirs(0), _factorizeJacobian(false), _tempState(nullptr), _initC(0),
+	_jacInlet(), _analyticJac(true), _jacobianAdDirs(0), _factorizeJacobian(false), _numFactorizations(0), _blockSolver(false), _tempState(nullptr), _initC(0),
 	_initQ(0), _initState(0), _initStateDot(0)
 {
 	// Multiple particle types are not supported
@@ -165,6 +166,12 @@ bool LumpedRateModelWithoutPores::configureModelDiscretization(IParameterProvide
 	const bool analyticJac = false;
 #endif
 
+	// Determine whether bound states are eliminated cell-wise before solving the bulk system
+	if (paramProvider.exists("USE_BLOCK_SOLVER"))
+		_blockSolver = paramProvider.getBool("USE_BLOCK_SOLVER");
+	else
+		_blockSolver = false;
+
 	// Allocate space for initial conditions
 	_initC.resize(_disc.nComp);
 	_initQ.resize(_disc.strideBound);
@@ -192,6 +199,21 @@ bool LumpedRateModelWithoutPores::configureModelDiscretization(IParameterProvide
 	_jacDisc.resize(_disc.nCol * strideCell, mb, mb);
 	_jacDisc.repartition(lb, ub);
 
+	if (_blockSolver)
+	{
+		// Liquid phase system only couples the same component in neighboring cells
+		const unsigned int lbBulk = lb / strideCell * _disc.nComp;
+		const unsigned int ubBulk = ub / strideCell * _disc.nComp;
+		const unsigned int mbBulk = mb / strideCell * _disc.nComp;
+
+		_jacBulk.resize(_disc.nCol * _disc.nComp, mbBulk, mbBulk);
+		_jacBulk.repartition(lbBulk, ubBulk);
+
+		_jacSolid.resize(_disc.nCol * _disc.strideBound * (_disc.strideBound + 2 * _disc.nComp));
+		_jacSolidPivot.resize(_disc.nCol * _disc.strideBound);
+		_tempBulk.resize(_disc.nCol * _disc.nComp);
+	}
+
 	// Set whether analytic Jacobian is used
 	useAnalyticJacobian(analyticJac);
 
@@ -363,6 +385,9 @@ void LumpedRateModelWithoutPores::notifyDiscontinuousSectionTransition(double t,
 		// Repartition Jacobians
 		_jac.repartition(lb, ub);
 		_jacDisc.repartition(lb, ub);
+
+		if (_blockSolver)
+			_jacBulk.repartition(lb / idxr.strideColCell() * _disc.nComp, ub / idxr.strideColCell() * _disc.nComp);
 	}
 	else
 	{
@@ -376,6 +401,9 @@ void LumpedRateModelWithoutPores::notifyDiscontinuousSectionTransition(double t,
 		// Repartition Jacobians
 		_jac.repartition(ub, lb);
 		_jacDisc.repartition(ub, lb);
+
+		if (_blockSolver)
+			_jacBulk.repartition(ub / idxr.strideColCell() * _disc.nComp, lb / idxr.strideColCell() * _disc.nComp);
 	}
 
 	prepareADvectors(adJac);
@@ -475,6 +503,8 @@ int LumpedRateModelWithoutPores::residual(const SimulationTime& simTime, const C
 {
 	if (updateJacobian)
 	{
+		BENCH_SCOPE(_timerJacobian);
+
 		_factorizeJacobian = true;
 
 #ifndef CADET_CHECK_ANALYTIC_JACOBIAN
@@ -645,34 +675,31 @@ int LumpedRateModelWithoutPores::residualSensFwdCombine(const SimulationTime& si
 {
 	BENCH_SCOPE(_timerResidualSens);
 
-	// tmp1 stores result of (dF / dy) * s
-	// tmp2 stores result of (dF / dyDot) * sDot
+	// Each sensitivity residual is accumulated directly in resS instead of the shared temporaries
+	// tmp1 and tmp2. Hence, the parameters are independent and can be processed in parallel.
+
+	BENCH_START(_timerResidualSensPar);
 
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(size_t(0), yS.size(), [&](size_t param)
+#else
 	for (unsigned int param = 0; param < yS.size(); ++param)
+#endif
 	{
-		// Directional derivative (dF / dy) * s
-		multiplyWithJacobian(SimulationTime{0.0, 0u}, ConstSimulationState{nullptr, nullptr}, yS[param], 1.0, 0.0, tmp1);
+		double* const ptrResS = resS[param];
 
 		// Directional derivative (dF / dyDot) * sDot
-		multiplyWithDerivativeJacobian(SimulationTime{0.0, 0u}, ConstSimulationState{nullptr, nullptr}, ySdot[param], tmp2);
+		multiplyWithDerivativeJacobian(SimulationTime{0.0, 0u}, ConstSimulationState{nullptr, nullptr}, ySdot[param], ptrResS);
 
-		double* const ptrResS = resS[param];
-
-		BENCH_START(_timerResidualSensPar);
+		// Add directional derivative (dF / dy) * s
+		multiplyWithJacobian(SimulationTime{0.0, 0u}, ConstSimulationState{nullptr, nullptr}, yS[param], 1.0, 1.0, ptrResS);
 
-		// Complete sens residual is the sum:
-		// TODO: Chunk TBB loop
-#ifdef CADET_PARALLELIZE
-		tbb::parallel_for(size_t(0), size_t(numDofs()), [&](size_t i)
-#else
+		// Complete sens residual is the sum
 		for (unsigned int i = 0; i < numDofs(); ++i)
-#endif
-		{
-			ptrResS[i] = tmp1[i] + tmp2[i] + adRes[i].getADValue(param);
-		} CADET_PARFOR_END;
+			ptrResS[i] += adRes[i].getADValue(param);
+	} CADET_PARFOR_END;
 
-		BENCH_STOP(_timerResidualSensPar);
-	}
+	BENCH_STOP(_timerResidualSensPar);
 
 	return 0;
 }
@@ -794,36 +821,53 @@ int LumpedRateModelWithoutPores::linearSolve(double t, double alpha, double oute
 
 	Indexer idxr(_disc);
 
-	bool success = true;
-
 	// Factorize Jacobian only if required
-	if (_factorizeJacobian)
-	{
-		// Assemble
-		assembleDiscretizedJacobian(alpha, idxr);
-
-		// Factorize
-		success = _jacDisc.factorize();
-		if (cadet_unlikely(!success))
-		{
-			LOG(Error) << "Factorize() failed for par block";
-		}
-
-		// Do not factorize again at next call without changed Jacobians
-		_factorizeJacobian = false;
-	}
+	const bool success = factorizeJacobianIfRequired(alpha, idxr);
 
 	// Handle inlet DOFs
 	_jacInlet.multiplySubtract(rhs, rhs + idxr.offsetC());
 
 	// Solve
-	const bool result = _jacDisc.solve(rhs + idxr.offsetC());
+	const bool result = _blockSolver ? solveBlockJacobian(rhs + idxr.offsetC(), idxr) : _jacDisc.solve(rhs + idxr.offsetC());
 	if (cadet_unlikely(!result))
 	{
 		LOG(Error) << "Solve() failed for bulk block";
 	}
 
-	return (success && result) ? 0 : 1;;
+	return (success && result) ? 0 : 1;
+}
+
+/**
+ * @brief Assembles and factorizes the time-discretized Jacobian if it has changed since the last factorization
+ * @param [in] alpha Value of \f$ \alpha \f$ (arises from BDF time discretization)
+ * @param [in] idxr Indexer
+ * @return @c true if the factorization was successful or not required, otherwise @c false
+ */
+bool LumpedRateModelWithoutPores::factorizeJacobianIfRequired(double alpha, const Indexer& idxr)
+{
+	if (!_factorizeJacobian)
+		return true;
+
+	++_numFactorizations;
+
+	// Assemble
+	assembleDiscretizedJacobian(alpha, idxr);
+
+	// Factorize
+	bool success = true;
+	if (_blockSolver)
+		success = factorizeBlockJacobian(idxr);
+	else
+		success = _jacDisc.factorize();
+
+	if (cadet_unlikely(!success))
+	{
+		LOG(Error) << "Factorize() failed for bulk block";
+	}
+
+	// Do not factorize again at next call without changed Jacobians
+	_factorizeJacobian = false;
+	return success;
 }
 
 /**
@@ -859,6 +903,189 @@ void LumpedRateModelWithoutPores::assembleDiscretizedJacobian(double alpha, cons
 	}
 }
 
+/**
+ * @brief Factorizes the time-discretized Jacobian by eliminating the bound states in each cell
+ * @details The bound states of a cell are only coupled to the liquid phase of the same cell. In each cell,
+ *          the Jacobian is partitioned into liquid (@f$ l @f$) and solid (@f$ s @f$) phase blocks
+ *          @f[ \begin{pmatrix} J_{ll} & J_{ls} \\ J_{sl} & J_{ss} \end{pmatrix}. @f]
+ *          The dense blocks @f$ J_{ss} @f$ are factorized independently (in parallel) and the Schur complement
+ *          @f$ S = J_{ll} - J_{ls} J_{ss}^{-1} J_{sl} @f$ replaces the diagonal block of the liquid phase system.
+ *          Since neighboring cells only couple the same component, the resulting liquid phase system is banded
+ *          with a bandwidth of @c nComp per cell instead of @c nComp + @c strideBound per cell. It is factorized
+ *          by LAPACK.
+ *          
+ *          Pivoting is only applied within the solid phase blocks and the reduced liquid phase system. Hence,
+ *          this method requires the blocks @f$ J_{ss} @f$ to be nonsingular, which holds for all binding models
+ *          with unique equilibrium.
+ *          
+ *          Before this function is called, assembleDiscretizedJacobian() has to be called.
+ *
+ * @param [in] idxr Indexer
+ * @return @c true if the factorization was successful, otherwise @c false
+ */
+bool LumpedRateModelWithoutPores::factorizeBlockJacobian(const Indexer& idxr)
+{
+	const int nComp = static_cast<int>(_disc.nComp);
+	const int nBound = static_cast<int>(_disc.strideBound);
+	const int strideCell = idxr.strideColCell();
+	const int lowerCells = static_cast<int>(_jacDisc.lowerBandwidth()) / strideCell;
+	const int upperCells = static_cast<int>(_jacDisc.upperBandwidth()) / strideCell;
+	const unsigned int blockSize = _disc.strideBound * (_disc.strideBound + 2 * _disc.nComp);
+
+	_jacBulk.setAll(0.0);
+
+	// Written concurrently by all cells that fail to factorize their solid block
+	std::atomic<bool> success(true);
+
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(size_t(0), size_t(_disc.nCol), [&](size_t col)
+#else
+	for (unsigned int col = 0; col < _disc.nCol; ++col)
+#endif
+	{
+		// Memory layout of the block: J_ss (nBound x nBound), X^T = (J_ss^{-1} J_sl)^T (nComp x nBound), J_ls (nComp x nBound)
+		double* const jacSS = _jacSolid.data() + col * blockSize;
+		double* const jacXt = jacSS + nBound * nBound;
+		double* const jacLS = jacXt + nComp * nBound;
+
+		const int offsetCell = static_cast<int>(col) * strideCell;
+		const int offsetBound = offsetCell + idxr.strideColLiquid();
+
+		for (int r = 0; r < nBound; ++r)
+		{
+			for (int c = 0; c < nBound; ++c)
+				jacSS[r * nBound + c] = _jacDisc.centered(offsetBound + r, c - r);
+		}
+
+		for (int comp = 0; comp < nComp; ++comp)
+		{
+			for (int r = 0; r < nBound; ++r)
+			{
+				// J_sl is stored column-wise, that is, transposed
+				jacXt[comp * nBound + r] = _jacDisc.centered(offsetBound + r, comp - idxr.strideColLiquid() - r);
+				jacLS[comp * nBound + r] = _jacDisc.centered(offsetCell + comp, idxr.strideColLiquid() + r - comp);
+			}
+		}
+
+		// Compute X = J_ss^{-1} J_sl column by column
+		if (nBound > 0)
+		{
+			linalg::DenseMatrixView blockSS(jacSS, _jacSolidPivot.data() + col * _disc.strideBound, _disc.strideBound, _disc.strideBound);
+			if (cadet_unlikely(!blockSS.factorize()))
+			{
+				LOG(Error) << "Factorize() failed for solid block " << col;
+				success = false;
+			}
+			else
+			{
+				// The columns of X are stored consecutively and solved in one LAPACK call
+				blockSS.solve(jacXt, _disc.nComp);
+			}
+		}
+
+		// Assemble liquid phase rows of reduced system
+		for (int comp = 0; comp < nComp; ++comp)
+		{
+			const int rowBulk = static_cast<int>(col) * nComp + comp;
+
+			// Schur complement S = J_ll - J_ls * X
+			for (int comp2 = 0; comp2 < nComp; ++comp2)
+			{
+				double val = _jacDisc.centered(offsetCell + comp, comp2 - comp);
+				for (int r = 0; r < nBound; ++r)
+					val -= jacLS[comp * nBound + r] * jacXt[comp2 * nBound + r];
+
+				_jacBulk.centered(rowBulk, comp2 - comp) = val;
+			}
+
+			// Coupling to same component in neighboring cells
+			for (int i = 1; (i <= lowerCells) && (i <= static_cast<int>(col)); ++i)
+				_jacBulk.centered(rowBulk, -i * nComp) = _jacDisc.centered(offsetCell + comp, -i * strideCell);
+
+			for (int i = 1; (i <= upperCells) && (static_cast<int>(col) + i < static_cast<int>(_disc.nCol)); ++i)
+				_jacBulk.centered(rowBulk, i * nComp) = _jacDisc.centered(offsetCell + comp, i * strideCell);
+		}
+	} CADET_PARFOR_END;
+
+	if (cadet_unlikely(!success))
+		return false;
+
+	return _jacBulk.factorize();
+}
+
+/**
+ * @brief Solves the time-discretized system using the factorization computed by factorizeBlockJacobian()
+ * @details In each cell, the solid phase right hand side @f$ b_s @f$ is eliminated by computing
+ *          @f$ y_s = J_{ss}^{-1} b_s @f$ and @f$ \tilde{b}_l = b_l - J_{ls} y_s @f$. After solving the
+ *          reduced liquid phase system @f$ x_l = S^{-1} \tilde{b}_l @f$, the solid phase solution is
+ *          recovered by @f$ x_s = y_s - J_{ss}^{-1} J_{sl} x_l @f$.
+ *
+ * @param [in,out] rhs On entry the right hand side (without inlet DOFs), on exit the solution
+ * @param [in] idxr Indexer
+ * @return @c true if the solution process was successful, otherwise @c false
+ */
+bool LumpedRateModelWithoutPores::solveBlockJacobian(double* const rhs, const Indexer& idxr)
+{
+	const int nComp = static_cast<int>(_disc.nComp);
+	const int nBound = static_cast<int>(_disc.strideBound);
+	const int strideCell = idxr.strideColCell();
+	const unsigned int blockSize = _disc.strideBound * (_disc.strideBound + 2 * _disc.nComp);
+
+	// Eliminate solid phase
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(size_t(0), size_t(_disc.nCol), [&](size_t col)
+#else
+	for (unsigned int col = 0; col < _disc.nCol; ++col)
+#endif
+	{
+		double* const jacSS = _jacSolid.data() + col * blockSize;
+		double const* const jacLS = jacSS + nBound * nBound + nComp * nBound;
+		double* const localRhs = rhs + col * strideCell;
+		double* const localBound = localRhs + idxr.strideColLiquid();
+		double* const localBulk = _tempBulk.data() + col * nComp;
+
+		if (nBound > 0)
+		{
+			linalg::DenseMatrixView blockSS(jacSS, _jacSolidPivot.data() + col * _disc.strideBound, _disc.strideBound, _disc.strideBound);
+			blockSS.solve(localBound);
+		}
+
+		for (int comp = 0; comp < nComp; ++comp)
+		{
+			double val = localRhs[comp];
+			for (int r = 0; r < nBound; ++r)
+				val -= jacLS[comp * nBound + r] * localBound[r];
+
+			localBulk[comp] = val;
+		}
+	} CADET_PARFOR_END;
+
+	// Solve liquid phase system
+	const bool result = _jacBulk.solve(_tempBulk.data());
+
+	// Recover solid phase
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(size_t(0), size_t(_disc.nCol), [&](size_t col)
+#else
+	for (unsigned int col = 0; col < _disc.nCol; ++col)
+#endif
+	{
+		double const* const jacXt = _jacSolid.data() + col * blockSize + nBound * nBound;
+		double* const localRhs = rhs + col * strideCell;
+		double* const localBound = localRhs + idxr.strideColLiquid();
+		double const* const localBulk = _tempBulk.data() + col * nComp;
+
+		for (int comp = 0; comp < nComp; ++comp)
+		{
+			localRhs[comp] = localBulk[comp];
+			for (int r = 0; r < nBound; ++r)
+				localBound[r] -= jacXt[comp * nBound + r] * localBulk[comp];
+		}
+	} CADET_PARFOR_END;
+
+	return result;
+}
+
 /**
  * @brief Adds Jacobian @f$ \frac{\partial F}{\partial \dot{y}} @f$ to cell of system Jacobian
  * @details Actually adds @f$ \alpha \frac{\partial F}{\partial \dot{y}} @f$, which is useful
@@ -1369,7 +1596,7 @@ void LumpedRateModelWithoutPores::consistentInitialTimeDerivative(const Simulati
 		}
 
 		// Copy row from original Jacobian and set right hand side
-		for (int i = 0; i < _disc.strideBound; ++i, ++jacSolid, ++jacSolidOrig)
+		for (unsigned int i = 0; i < _disc.strideBound; ++i, ++jacSolid, ++jacSolidOrig)
 		{
 			if (!mask[i])
 				continue;
@@ -1622,41 +1849,75 @@ void LumpedRateModelWithoutPores::consistentInitialSensitivity(const SimulationT
 		multiplyWithJacobian(simTime, simState, sensY, -1.0, 1.0, sensYdot);
 
 		// Note that we have correctly negated the right hand side
+	}
+
+	// The matrix of step 2 does not depend on the parameter. Hence, it is assembled and
+	// factorized only once (step 1 uses the memory of _jacDisc as scratch space) and then
+	// applied to all right hand sides
+	_jacDisc.setAll(0.0);
 
-		_jacDisc.setAll(0.0);
+	// Handle transport equations (dc_i / dt terms)
+	_convDispOp.addTimeDerivativeToJacobian(1.0, _jacDisc);
 
-		// Handle transport equations (dc_i / dt terms)
-		_convDispOp.addTimeDerivativeToJacobian(1.0, _jacDisc);
+	const double invBeta = 1.0 / static_cast<double>(_totalPorosity) - 1.0;
+	for (unsigned int col = 0; col < _disc.nCol; ++col)
+	{
+		// Assemble
+		linalg::FactorizableBandMatrix::RowIterator jac = _jacDisc.row(idxr.strideColCell() * col);
 
-		const double invBeta = 1.0 / static_cast<double>(_totalPorosity) - 1.0;
-		for (unsigned int col = 0; col < _disc.nCol; ++col)
-		{
-			// Assemble
-			linalg::FactorizableBandMatrix::RowIterator jac = _jacDisc.row(idxr.strideColCell() * col);
+		// Mobile and solid phase (advances jac accordingly)
+		addTimeDerivativeToJacobianCell(jac, idxr, 1.0, invBeta);
 
-			// Mobile and solid phase (advances jac accordingly)
-			addTimeDerivativeToJacobianCell(jac, idxr, 1.0, invBeta);
+		// Iterator jac has already been advanced to next shell
 
-			// Iterator jac has already been advanced to next shell
+		// Overwrite rows corresponding to algebraic equations with the Jacobian
+		if (_binding[0]->hasQuasiStationaryReactions())
+		{
+			// Get iterators to beginning of solid phase
+			linalg::BandMatrix::RowIterator jacSolidOrig = _jac.row(idxr.strideColCell() * col + idxr.strideColLiquid());
+			linalg::FactorizableBandMatrix::RowIterator jacSolid = jac - idxr.strideColLiquid();
+
+			int const* const mask = _binding[0]->reactionQuasiStationarity();
 
-			// Overwrite rows corresponding to algebraic equations with the Jacobian and set right hand side to 0
-			if (_binding[0]->hasQuasiStationaryReactions())
+			// Copy row from original Jacobian
+			for (unsigned int i = 0; i < _disc.strideBound; ++i, ++jacSolid, ++jacSolidOrig)
 			{
-				// Get iterators to beginning of solid phase
-				linalg::BandMatrix::RowIterator jacSolidOrig = _jac.row(idxr.strideColCell() * col + idxr.strideColLiquid());
-				linalg::FactorizableBandMatrix::RowIterator jacSolid = jac - idxr.strideColLiquid();
+				if (!mask[i])
+					continue;
 
-				int const* const mask = _binding[0]->reactionQuasiStationarity();
-				double* const qShellDot = sensYdot + idxr.offsetC() + idxr.strideColCell() * col + idxr.strideColLiquid();
+				jacSolid.copyRowFrom(jacSolidOrig);
+			}
+		}
+	}
 
-				// Copy row from original Jacobian and set right hand side
-				for (int i = 0; i < _disc.strideBound; ++i, ++jacSolid, ++jacSolidOrig)
+	// Precondition
+	double* const scaleFactors = _tempState + idxr.offsetC();
+	_jacDisc.rowScaleFactors(scaleFactors);
+	_jacDisc.scaleRows(scaleFactors);
+
+	// Factorize
+	const bool result = _jacDisc.factorize();
+	if (!result)
+	{
+		LOG(Error) << "Factorize() failed for par block";
+	}
+
+	for (unsigned int param = 0; param < vecSensY.size(); ++param)
+	{
+		double* const sensYdot = vecSensYdot[param];
+
+		// Set right hand side of algebraic equations to 0
+		if (_binding[0]->hasQuasiStationaryReactions())
+		{
+			int const* const mask = _binding[0]->reactionQuasiStationarity();
+			for (unsigned int col = 0; col < _disc.nCol; ++col)
+			{
+				double* const qShellDot = sensYdot + idxr.offsetC() + idxr.strideColCell() * col + idxr.strideColLiquid();
+				for (unsigned int i = 0; i < _disc.strideBound; ++i)
 				{
 					if (!mask[i])
 						continue;
 
-					jacSolid.copyRowFrom(jacSolidOrig);
-
 					// Right hand side is -\frac{\partial^2 res(t, y, \dot{y})}{\partial p \partial t}
 					// If the residual is not explicitly depending on time, this expression is 0
 					// @todo This is wrong if external functions are used. Take that into account!
@@ -1665,18 +1926,6 @@ void LumpedRateModelWithoutPores::consistentInitialSensitivity(const SimulationT
 			}
 		}
 
-		// Precondition
-		double* const scaleFactors = _tempState + idxr.offsetC();
-		_jacDisc.rowScaleFactors(scaleFactors);
-		_jacDisc.scaleRows(scaleFactors);
-
-		// Factorize
-		const bool result = _jacDisc.factorize();
-		if (!result)
-		{
-			LOG(Error) << "Factorize() failed for par block";
-		}
-
 		const bool result2 = _jacDisc.solve(scaleFactors, sensYdot + idxr.offsetC());
 		if (!result2)
 		{
@@ -142,6 +142,7 @@ public:
 	virtual void setSensitiveParameterValue(const ParameterId& id, double value);
 
 	virtual unsigned int threadLocalMemorySize() const CADET_NOEXCEPT;
+	virtual LinearSolverStatistics linearSolverStatistics() const CADET_NOEXCEPT { return LinearSolverStatistics{_numFactorizations, _gmres.numIterations()}; }
 
 #ifdef CADET_BENCHMARK_MODE
 	virtual std::vector<double> benchmarkTimings() const
@@ -152,9 +153,14 @@ public:
 			_timerResidualPar.totalElapsedTime(),
 			_timerResidualSens.totalElapsedTime(),
 			_timerResidualSensPar.totalElapsedTime(),
+			_timerJacobian.totalElapsedTime(),
 			_timerConsistentInit.totalElapsedTime(),
 			_timerConsistentInitPar.totalElapsedTime(),
 			_timerLinearSolve.totalElapsedTime()
+			BENCH_COUNTERS(_timerResidual.counters())
+			BENCH_COUNTERS(_timerJacobian.counters())
+			BENCH_COUNTERS(_timerLinearSolve.counters())
+			BENCH_COUNTERS(_timerConsistentInit.counters())
 		});
 	}
 
@@ -166,9 +172,14 @@ public:
 			"ResidualPar",
 			"ResidualSens",
 			"ResidualSensPar",
+			"Jacobian",
 			"ConsistentInit",
 			"ConsistentInitPar",
 			"LinearSolve"
+			BENCH_COUNTER_DESC("Residual")
+			BENCH_COUNTER_DESC("Jacobian")
+			BENCH_COUNTER_DESC("LinearSolve")
+			BENCH_COUNTER_DESC("ConsistentInit")
 		};
 		return desc;
 	}
@@ -188,6 +199,10 @@ protected:
 	void assembleDiscretizedJacobian(double alpha, const Indexer& idxr);
 	void addTimeDerivativeToJacobianCell(linalg::FactorizableBandMatrix::RowIterator& jac, const Indexer& idxr, double alpha, double invBetaP) const;
 
+	bool factorizeJacobianIfRequired(double alpha, const Indexer& idxr);
+	bool factorizeBlockJacobian(const Indexer& idxr);
+	bool solveBlockJacobian(double* const rhs, const Indexer& idxr);
+
 #ifdef CADET_CHECK_ANALYTIC_JACOBIAN
 	void checkAnalyticJacobianAgainstAd(active const* const adRes, unsigned int adDirOffset) const;
 #endif
@@ -217,6 +232,12 @@ protected:
 	unsigned int _jacobianAdDirs; //!< Number of AD seed vectors required for Jacobian computation
 
 	bool _factorizeJacobian; //!< Determines whether the Jacobian needs to be factorized
+	int _numFactorizations; //!< Number of Jacobian factorizations in linearSolve()
+	bool _blockSolver; //!< Determines whether bound states are eliminated cell-wise before the liquid phase system is solved
+	linalg::FactorizableBandMatrix _jacBulk; //!< Liquid phase Schur complement of the time-discretized Jacobian (block solver only)
+	std::vector<double> _jacSolid; //!< Factorized solid phase blocks and their coupling to the liquid phase in each cell (block solver only)
+	std::vector<lapackInt_t> _jacSolidPivot; //!< Pivots of the factorized solid phase blocks (block solver only)
+	std::vector<double> _tempBulk; //!< Right hand side of the liquid phase system (block solver only)
 	double* _tempState; //!< Temporary storage with the size of the state vector or larger if binding models require it
 	linalg::Gmres _gmres; //!< GMRES algorithm for the Schur-complement in linearSolve()
 	double _schurSafety; //!< Safety factor for Schur-complement solution
@@ -230,6 +251,7 @@ protected:
 	BENCH_TIMER(_timerResidualPar)
 	BENCH_TIMER(_timerResidualSens)
 	BENCH_TIMER(_timerResidualSensPar)
+	BENCH_TIMER(_timerJacobian)
 	BENCH_TIMER(_timerConsistentInit)
 	BENCH_TIMER(_timerConsistentInitPar)
 	BENCH_TIMER(_timerLinearSolve)
@@ -1412,6 +1412,22 @@ void ModelSystem::setupParallelization(unsigned int numThreads)
 	_threadLocalStorage.resize(numThreads, tlsSize);
 }
 
+int ModelSystem::globalOutletIndex(UnitOpIdx unitOpIdx, unsigned int port, unsigned int comp) const
+{
+	for (unsigned int i = 0; i < _models.size(); ++i)
+	{
+		IUnitOperation const* const m = _models[i];
+		if (m->unitOperationId() != unitOpIdx)
+			continue;
+
+		if ((port >= m->numOutletPorts()) || (comp >= m->numComponents()))
+			return -1;
+
+		return _dofOffset[i] + m->localOutletComponentIndex(port) + comp * m->localOutletComponentStride(port);
+	}
+	return -1;
+}
+
 }  // namespace model
 
 }  // namespace cadet
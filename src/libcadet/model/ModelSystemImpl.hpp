@@ -145,6 +145,10 @@ public:
 
 	virtual void setupParallelization(unsigned int numThreads);
 
+	virtual int globalOutletIndex(UnitOpIdx unitOpIdx, unsigned int port, unsigned int comp) const;
+	virtual LinearSolverStatistics linearSolverStatistics(unsigned int index) const CADET_NOEXCEPT { return _models[index]->linearSolverStatistics(); }
+	virtual int numCouplingGmresIterations() const CADET_NOEXCEPT { return _gmres.numIterations(); }
+
 #ifdef CADET_BENCHMARK_MODE
 	virtual std::vector<double> benchmarkTimings() const
 	{
@@ -157,6 +161,9 @@ public:
 			_timerLinearSolve.totalElapsedTime(),
 			_timerMatVec.totalElapsedTime(),
 			static_cast<double>(_gmres.numIterations())
+			BENCH_COUNTERS(_timerResidual.counters())
+			BENCH_COUNTERS(_timerLinearSolve.counters())
+			BENCH_COUNTERS(_timerConsistentInit.counters())
 		});
 	}
 
@@ -171,6 +178,9 @@ public:
 			"LinearSolve",
 			"MatVec",
 			"NumGMRESIter"
+			BENCH_COUNTER_DESC("Residual")
+			BENCH_COUNTER_DESC("LinearSolve")
+			BENCH_COUNTER_DESC("ConsistentInit")
 		};
 		return desc;
 	}
@@ -62,7 +62,7 @@ namespace
 
 
 CSTRModel::CSTRModel(UnitOpIdx unitOpIdx) : UnitOperationBase(unitOpIdx), _nComp(0), _nParType(0), _nBound(nullptr), _boundOffset(nullptr), _strideBound(nullptr), _offsetParType(nullptr), 
-	_totalBound(0), _analyticJac(true), _jac(), _jacFact(), _factorizeJac(false), _initConditions(0), _initConditionsDot(0), _dynReactionBulk(nullptr)
+	_totalBound(0), _analyticJac(true), _jac(), _jacFact(), _factorizeJac(false), _numFactorizations(0), _initConditions(0), _initConditionsDot(0), _dynReactionBulk(nullptr)
 {
 	// Mutliplexed binding and reaction models make no sense in CSTR
 	_singleBinding = false;
@@ -1844,22 +1844,34 @@ int CSTRModel::linearSolve(double t, double alpha, double tol, double* const rhs
 		rhs[i + _nComp] += flowIn * rhs[i];
 	}
 
-	bool success = true;
-	if (_factorizeJac)
-	{
-		// Factorization is necessary
-		_factorizeJac = false;
-		_jacFact.copyFrom(_jac);
-
-		addTimeDerivativeJacobian(t, alpha, simState, _jacFact);
-		success = _jacFact.factorize();
-	}
+	bool success = factorizeJacobianIfRequired(t, alpha, simState);
 	success = success && _jacFact.solve(rhs + _nComp);
 
 	// Return 0 on success and 1 on failure
 	return success ? 0 : 1;
 }
 
+/**
+ * @brief Assembles and factorizes the time-discretized Jacobian if it has changed since the last factorization
+ * @param [in] t Current time point
+ * @param [in] alpha Value of \f$ \alpha \f$ (arises from BDF time discretization)
+ * @param [in] simState State of the simulation (state vector and its time derivatives) at which the Jacobian is evaluated
+ * @return @c true if the factorization was successful or not required, otherwise @c false
+ */
+bool CSTRModel::factorizeJacobianIfRequired(double t, double alpha, const ConstSimulationState& simState)
+{
+	if (!_factorizeJac)
+		return true;
+
+	// Factorization is necessary
+	_factorizeJac = false;
+	++_numFactorizations;
+	_jacFact.copyFrom(_jac);
+
+	addTimeDerivativeJacobian(t, alpha, simState, _jacFact);
+	return _jacFact.factorize();
+}
+
 template <typename MatrixType>
 void CSTRModel::addTimeDerivativeJacobian(double t, double alpha, const ConstSimulationState& simState, MatrixType& mat)
 {
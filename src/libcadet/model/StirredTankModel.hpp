@@ -121,6 +121,7 @@ public:
 	virtual void expandErrorTol(double const* errorSpec, unsigned int errorSpecSize, double* expandOut) { }
 
 	virtual unsigned int threadLocalMemorySize() const CADET_NOEXCEPT;
+	virtual LinearSolverStatistics linearSolverStatistics() const CADET_NOEXCEPT { return LinearSolverStatistics{_numFactorizations, 0}; }
 
 #ifdef CADET_BENCHMARK_MODE
 	virtual std::vector<double> benchmarkTimings() const { return std::vector<double>(0); }
@@ -139,6 +140,7 @@ protected:
 
 	template <typename MatrixType>
 	void addTimeDerivativeJacobian(double t, double alpha, const ConstSimulationState& simState, MatrixType& mat);
+	bool factorizeJacobianIfRequired(double t, double alpha, const ConstSimulationState& simState);
 
 	void extractJacobianFromAD(active const* const adRes, unsigned int adDirOffset);
 #ifdef CADET_CHECK_ANALYTIC_JACOBIAN
@@ -164,6 +166,7 @@ protected:
 	linalg::DenseMatrix _jac; //!< Jacobian
 	linalg::DenseMatrix _jacFact; //!< Factorized Jacobian
 	bool _factorizeJac; //!< Flag that tracks whether the Jacobian needs to be factorized
+	int _numFactorizations; //!< Number of Jacobian factorizations in linearSolve()
 
 	std::vector<active> _initConditions; //!< Initial conditions, ordering: Liquid phase concentration, solid phase concentration, volume
 	std::vector<double> _initConditionsDot; //!< Initial conditions for time derivative
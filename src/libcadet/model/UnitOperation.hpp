@@ -41,6 +41,15 @@ namespace util
 	class ThreadLocalStorage;
 }
 
+/**
+ * @brief Accumulated counters of the linear solver of a unit operation
+ */
+struct LinearSolverStatistics
+{
+	int numFactorizations; //!< Number of factorizations of the time-discretized Jacobian
+	int numGmresIterations; //!< Number of GMRES iterations (matrix-vector products)
+};
+
 /**
  * @brief Defines an unit operation model interface
  * @details 
@@ -576,6 +585,13 @@ public:
 	 * @return Required thread local memory size in bytes
 	 */
 	virtual unsigned int threadLocalMemorySize() const CADET_NOEXCEPT = 0;
+
+	/**
+	 * @brief Returns the counters of the linear solver
+	 * @details The counters are accumulated over the lifetime of the unit operation.
+	 * @return Linear solver statistics
+	 */
+	virtual LinearSolverStatistics linearSolverStatistics() const CADET_NOEXCEPT = 0;
 };
 
 } // namespace cadet
@@ -20,9 +20,15 @@
 #include "LoggingUtils.hpp"
 #include "Logging.hpp"
 
+#include <algorithm>
 #include <iterator>
 #include <limits>
 
+#include "ParallelSupport.hpp"
+#ifdef CADET_PARALLELIZE
+	#include <tbb/tbb.h>
+#endif
+
 namespace cadet
 {
 
@@ -450,24 +456,26 @@ int UnitOperationBase::residualSensFwdCombine(const SimulationTime& simTime, con
 	const std::vector<const double*>& yS, const std::vector<const double*>& ySdot, const std::vector<double*>& resS, active const* adRes,
 	double* const tmp1, double* const tmp2, double* const tmp3)
 {
+	// Each sensitivity residual is accumulated directly in resS, the parameters are processed in parallel
+#ifdef CADET_PARALLELIZE
+	tbb::parallel_for(size_t(0), yS.size(), [&](size_t param)
+#else
 	for (unsigned int param = 0; param < yS.size(); ++param)
+#endif
 	{
-		// tmp1 stores result of (dF / dy) * s
-		// tmp2 stores result of (dF / dyDot) * sDot
-
-		// Directional derivative (dF / dy) * s
-		multiplyWithJacobian(simTime, simState, yS[param], 1.0, 0.0, tmp1);
+		double* const ptrResS = resS[param];
 
 		// Directional derivative (dF / dyDot) * sDot
-		multiplyWithDerivativeJacobian(simTime, simState, ySdot[param], tmp2);
+		multiplyWithDerivativeJacobian(simTime, simState, ySdot[param], ptrResS);
 
-		// Complete sens residual is the sum:
-		double* const ptrResS = resS[param];
+		// Add directional derivative (dF / dy) * s
+		multiplyWithJacobian(simTime, simState, yS[param], 1.0, 1.0, ptrResS);
+
+		// Complete sens residual is the sum
 		for (unsigned int i = 0; i < numDofs(); ++i)
-		{
-			ptrResS[i] = tmp1[i] + tmp2[i] + adRes[i].getADValue(param);
-		}
-	}
+			ptrResS[i] += adRes[i].getADValue(param);
+	} CADET_PARFOR_END;
+
 	return 0;
 }
 
@@ -776,6 +776,54 @@ bool ConvectionDispersionOperator::solveTimeDerivativeSystem(const SimulationTim
 	return true;
 }
 
+/**
+ * @brief Solves systems with the time derivative Jacobian for multiple right hand sides
+ * @details The time derivative Jacobian is assembled and factorized only once. The right hand side
+ *          of each system starts at the given @p offset in the corresponding vector of @p rhs,
+ *          which is assumed to point to the first axial DOF. The right hand sides are copied to
+ *          contiguous memory and solved at once.
+ * @param [in] simTime Simulation time information (time point, section index, pre-factor of time derivatives)
+ * @param [in,out] rhs Array with pointers to right hand sides, on exit the solutions
+ * @param [in] nRhs Number of right hand sides
+ * @param [in] offset Offset of the bulk block in each right hand side vector
+ * @return @c true if the systems were solved correctly, @c false otherwise
+ */
+bool ConvectionDispersionOperator::solveTimeDerivativeSystem(const SimulationTime& simTime, double* const* rhs, unsigned int nRhs, unsigned int offset)
+{
+	// Assemble
+	_jacCdisc.setAll(0.0);
+	addTimeDerivativeToJacobian(1.0);
+
+	// Factorize
+	const bool result = _jacCdisc.factorize();
+	if (!result)
+	{
+		LOG(Error) << "Factorize() failed for bulk block";
+		return false;
+	}
+
+	// Gather right hand sides in contiguous memory, which is reused for subsequent calls
+	const unsigned int nRows = _jacCdisc.rows();
+	if (_multiRhs.size() < nRows * nRhs)
+		_multiRhs.resize(nRows * nRhs);
+
+	for (unsigned int i = 0; i < nRhs; ++i)
+		std::copy_n(rhs[i] + offset, nRows, _multiRhs.data() + i * nRows);
+
+	// Solve all systems in one LAPACK call
+	const bool result2 = _jacCdisc.solve(_multiRhs.data(), nRhs);
+	if (!result2)
+	{
+		LOG(Error) << "Solve() failed for bulk block";
+		return false;
+	}
+
+	for (unsigned int i = 0; i < nRhs; ++i)
+		std::copy_n(_multiRhs.data() + i * nRows, nRows, rhs[i] + offset);
+
+	return true;
+}
+
 }  // namespace parts
 
 }  // namespace model
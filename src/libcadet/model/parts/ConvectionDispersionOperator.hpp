@@ -183,6 +183,7 @@ public:
 	void extractJacobianFromAD(active const* const adRes, unsigned int adDirOffset);
 
 	bool solveTimeDerivativeSystem(const SimulationTime& simTime, double* const rhs);
+	bool solveTimeDerivativeSystem(const SimulationTime& simTime, double* const* rhs, unsigned int nRhs, unsigned int offset);
 	void multiplyWithDerivativeJacobian(const SimulationTime& simTime, double const* sDot, double* ret) const;
 
 	bool assembleAndFactorizeDiscretizedJacobian(double alpha);
@@ -224,6 +225,7 @@ protected:
 
 	linalg::BandMatrix _jacC; //!< Jacobian
 	linalg::FactorizableBandMatrix _jacCdisc; //!< Jacobian with time derivatives from BDF method
+	std::vector<double> _multiRhs; //!< Contiguous right hand sides for solving multiple systems at once
 
 	// Indexer functionality
 
@@ -1255,6 +1255,19 @@ bool TwoDimensionalConvectionDispersionOperator::solveTimeDerivativeSystem(const
 	return true;
 }
 
+/**
+ * @brief Solves systems with the time derivative Jacobian for multiple right hand sides
+ * @param [in] simTime Simulation time information (time point, section index, pre-factor of time derivatives)
+ * @param [in,out] rhs Array with pointers to right hand sides, on exit the solutions
+ * @param [in] nRhs Number of right hand sides
+ * @param [in] offset Offset of the bulk block in each right hand side vector
+ * @return @c true if the systems were solved correctly, @c false otherwise
+ */
+bool TwoDimensionalConvectionDispersionOperator::solveTimeDerivativeSystem(const SimulationTime& simTime, double* const* rhs, unsigned int nRhs, unsigned int offset)
+{
+	return true;
+}
+
 void TwoDimensionalConvectionDispersionOperator::setEquidistantRadialDisc()
 {
 	const active h = _colRadius / _nRad;
@@ -80,6 +80,7 @@ public:
 	int residual(double t, unsigned int secIdx, double const* y, double const* yDot, active* res, bool wantJac, WithParamSensitivity);
 
 	bool solveTimeDerivativeSystem(const SimulationTime& simTime, double* const rhs);
+	bool solveTimeDerivativeSystem(const SimulationTime& simTime, double* const* rhs, unsigned int nRhs, unsigned int offset);
 	void multiplyWithDerivativeJacobian(const SimulationTime& simTime, double const* sDot, double* ret) const;
 
 	bool assembleAndFactorizeDiscretizedJacobian(double alpha);
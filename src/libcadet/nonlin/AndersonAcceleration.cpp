@@ -0,0 +1,162 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include "nonlin/AndersonAcceleration.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	inline double dot(double const* a, double const* b, unsigned int n)
+	{
+		double res = 0.0;
+		for (unsigned int i = 0; i < n; ++i)
+			res += a[i] * b[i];
+		return res;
+	}
+}
+
+namespace cadet
+{
+
+namespace nonlin
+{
+
+AndersonAcceleration::AndersonAcceleration() : _size(0), _depth(0), _nHist(0), _head(0), _hasLast(false) { }
+
+AndersonAcceleration::AndersonAcceleration(unsigned int size, unsigned int depth) : AndersonAcceleration()
+{
+	resize(size, depth);
+}
+
+void AndersonAcceleration::resize(unsigned int size, unsigned int depth)
+{
+	_size = size;
+	_depth = depth;
+
+	_diffF.resize(size * depth);
+	_diffG.resize(size * depth);
+	_lastF.resize(size);
+	_lastG.resize(size);
+	_curG.resize(size);
+	_q.resize(size * depth);
+	_r.resize(depth * depth);
+	_gamma.resize(depth);
+	_active.reserve(depth);
+
+	reset();
+}
+
+void AndersonAcceleration::reset()
+{
+	_nHist = 0;
+	_head = 0;
+	_hasLast = false;
+}
+
+void AndersonAcceleration::update(double* const x, double const* const fx)
+{
+	if (_depth == 0)
+	{
+		std::copy_n(fx, _size, x);
+		return;
+	}
+
+	for (unsigned int i = 0; i < _size; ++i)
+		_curG[i] = fx[i] - x[i];
+
+	// Append differences to history, overwrite oldest entry if history is full
+	if (_hasLast)
+	{
+		double* const dF = _diffF.data() + _head * _size;
+		double* const dG = _diffG.data() + _head * _size;
+		for (unsigned int i = 0; i < _size; ++i)
+		{
+			dF[i] = fx[i] - _lastF[i];
+			dG[i] = _curG[i] - _lastG[i];
+		}
+
+		_head = (_head + 1) % _depth;
+		_nHist = std::min(_nHist + 1, _depth);
+	}
+
+	std::copy_n(fx, _size, _lastF.data());
+	std::copy_n(_curG.data(), _size, _lastG.data());
+	_hasLast = true;
+
+	// Start with plain fixed-point step x_{k+1} = F(x_k)
+	std::copy_n(fx, _size, x);
+	if (_nHist == 0)
+		return;
+
+	// QR decomposition of residual differences by modified Gram-Schmidt, skip linearly dependent columns
+	_active.clear();
+	for (unsigned int j = 0; j < _nHist; ++j)
+	{
+		double const* const dG = _diffG.data() + j * _size;
+		const unsigned int col = _active.size();
+		double* const qj = _q.data() + col * _size;
+		std::copy_n(dG, _size, qj);
+
+		const double normOrig = std::sqrt(dot(qj, qj, _size));
+		if (normOrig == 0.0)
+			continue;
+
+		for (unsigned int k = 0; k < col; ++k)
+		{
+			double const* const qk = _q.data() + k * _size;
+			const double rkj = dot(qk, qj, _size);
+			_r[k + col * _depth] = rkj;
+			for (unsigned int i = 0; i < _size; ++i)
+				qj[i] -= rkj * qk[i];
+		}
+
+		const double rjj = std::sqrt(dot(qj, qj, _size));
+		if (rjj <= 1e-12 * normOrig)
+			continue;
+
+		_r[col + col * _depth] = rjj;
+		for (unsigned int i = 0; i < _size; ++i)
+			qj[i] /= rjj;
+
+		_active.push_back(j);
+	}
+
+	const unsigned int nActive = _active.size();
+	if (nActive == 0)
+		return;
+
+	// Solve R * gamma = Q^T * g by back substitution
+	for (unsigned int k = 0; k < nActive; ++k)
+		_gamma[k] = dot(_q.data() + k * _size, _curG.data(), _size);
+
+	for (unsigned int k = nActive; k-- > 0; )
+	{
+		for (unsigned int j = k + 1; j < nActive; ++j)
+			_gamma[k] -= _r[k + j * _depth] * _gamma[j];
+		_gamma[k] /= _r[k + k * _depth];
+	}
+
+	// x_{k+1} = F(x_k) - sum_j gamma_j * dF_j
+	for (unsigned int k = 0; k < nActive; ++k)
+	{
+		double const* const dF = _diffF.data() + _active[k] * _size;
+		const double g = _gamma[k];
+		for (unsigned int i = 0; i < _size; ++i)
+			x[i] -= g * dF[i];
+	}
+}
+
+} // namespace nonlin
+
+} // namespace cadet
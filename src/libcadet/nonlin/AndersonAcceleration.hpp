@@ -0,0 +1,107 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+/**
+ * @file 
+ * Implements Anderson acceleration for fixed-point iterations
+ */
+
+#ifndef LIBCADET_ANDERSONACCELERATION_HPP_
+#define LIBCADET_ANDERSONACCELERATION_HPP_
+
+#include "cadet/cadetCompilerInfo.hpp"
+
+#include <vector>
+
+namespace cadet
+{
+
+namespace nonlin
+{
+
+	/**
+	 * @brief Accelerates the fixed-point iteration @f$ x_{k+1} = F(x_k) @f$ by Anderson mixing
+	 * @details Given the current iterate @f$ x_k @f$ and its image @f$ F(x_k) @f$, the next iterate is computed
+	 *          from the last @f$ m @f$ iterates by
+	 *          @f[ \begin{align} x_{k+1} = F(x_k) - \sum_{j} \gamma_j \Delta F_j, \end{align} @f]
+	 *          where @f$ \Delta F_j @f$ denote the differences of consecutive images and the coefficients
+	 *          @f$ \gamma @f$ minimize @f$ \left\lVert g_k - \sum_j \gamma_j \Delta g_j \right\rVert_2 @f$ with
+	 *          residuals @f$ g_k = F(x_k) - x_k @f$ (type II Anderson acceleration, see Walker and Ni (2011),
+	 *          SIAM J. Numer. Anal. 49(4), 1715-1735). The least squares problem is solved by a QR
+	 *          decomposition (modified Gram-Schmidt), which drops linearly dependent columns.
+	 *
+	 *          A depth of @c 0 yields the plain fixed-point iteration.
+	 */
+	class AndersonAcceleration
+	{
+	public:
+		AndersonAcceleration();
+
+		/**
+		 * @brief Creates an accelerator for the given problem size and depth
+		 * @param [in] size Number of unknowns
+		 * @param [in] depth Maximum number of stored differences (@c 0 disables acceleration)
+		 */
+		AndersonAcceleration(unsigned int size, unsigned int depth);
+
+		/**
+		 * @brief Changes problem size and depth and clears the history
+		 * @param [in] size Number of unknowns
+		 * @param [in] depth Maximum number of stored differences (@c 0 disables acceleration)
+		 */
+		void resize(unsigned int size, unsigned int depth);
+
+		/**
+		 * @brief Clears the history of previous iterates
+		 */
+		void reset();
+
+		/**
+		 * @brief Computes the next iterate
+		 * @details Both vectors have to be of the size given on construction (see resize()).
+		 * @param [in,out] x On entry, current iterate @f$ x_k @f$; on exit, next iterate @f$ x_{k+1} @f$
+		 * @param [in] fx Image of the current iterate @f$ F(x_k) @f$
+		 */
+		void update(double* const x, double const* const fx);
+
+		inline unsigned int size() const CADET_NOEXCEPT { return _size; }
+		inline unsigned int depth() const CADET_NOEXCEPT { return _depth; }
+
+		/**
+		 * @brief Returns the number of differences currently stored in the history
+		 * @return Number of stored differences
+		 */
+		inline unsigned int historyLength() const CADET_NOEXCEPT { return _nHist; }
+
+	protected:
+		unsigned int _size; //!< Number of unknowns
+		unsigned int _depth; //!< Maximum number of stored differences
+		unsigned int _nHist; //!< Number of stored differences
+		unsigned int _head; //!< Index of the column that is overwritten next in the ring buffers
+		bool _hasLast; //!< Determines whether the last iterate is available
+
+		std::vector<double> _diffF; //!< Ring buffer with differences of consecutive images, column-major (size x depth)
+		std::vector<double> _diffG; //!< Ring buffer with differences of consecutive residuals, column-major (size x depth)
+		std::vector<double> _lastF; //!< Image of the last iterate
+		std::vector<double> _lastG; //!< Residual of the last iterate
+		std::vector<double> _curG; //!< Residual of the current iterate
+		std::vector<double> _q; //!< Orthonormal factor Q of the QR decomposition, column-major (size x depth)
+		std::vector<double> _r; //!< Upper triangular factor R of the QR decomposition, column-major (depth x depth)
+		std::vector<double> _gamma; //!< Mixing coefficients
+		std::vector<unsigned int> _active; //!< Indices of the linearly independent history columns
+	};
+
+} // namespace nonlin
+
+} // namespace cadet
+
+#endif  // LIBCADET_ANDERSONACCELERATION_HPP_
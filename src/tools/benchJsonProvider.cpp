@@ -0,0 +1,172 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <limits>
+
+#include <tclap/CmdLine.h>
+#include "common/TclapUtils.hpp"
+#include "common/JsonParameterProvider.hpp"
+#include "common/CompactJsonParameterProvider.hpp"
+
+struct ProgramOptions
+{
+	std::string fileName;
+	std::size_t numElements;
+	int repetitions;
+};
+
+/**
+ * @brief Creates a JSON document with large arrays similar to generated CADET inputs
+ * @param [in] numElements Number of elements in each array
+ * @return JSON document
+ */
+std::string createDocument(std::size_t numElements)
+{
+	std::mt19937 gen(42);
+	std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+	std::ostringstream oss;
+	oss << std::setprecision(std::numeric_limits<double>::digits10 + 1);
+	oss << "{\"input\": {\"model\": {\"NUNITS\": 1, \"INIT_STATE\": [";
+	for (std::size_t i = 0; i < numElements; ++i)
+		oss << ((i > 0) ? ", " : "") << dist(gen);
+	oss << "], \"unit_000\": {\"UNIT_TYPE\": \"INLET\", \"EXT_PROFILE\": [";
+	for (std::size_t i = 0; i < numElements; ++i)
+		oss << ((i > 0) ? ", " : "") << dist(gen) * 1e-3;
+	oss << "]}}, \"solver\": {\"USER_SOLUTION_TIMES\": [";
+	for (std::size_t i = 0; i < numElements; ++i)
+		oss << ((i > 0) ? ", " : "") << static_cast<double>(i) * 0.25;
+	oss << "]}}}";
+
+	return oss.str();
+}
+
+/**
+ * @brief Parses the document and reads all arrays of the synthetic document
+ * @param [in] doc JSON document
+ * @return Checksum of the read arrays
+ */
+template <typename ParamProvider_t>
+double parseAndRead(const std::string& doc)
+{
+	ParamProvider_t pp(doc);
+	pp.pushScope("input");
+
+	double sum = 0.0;
+	pp.pushScope("model");
+	for (double v : pp.getDoubleArray("INIT_STATE"))
+		sum += v;
+
+	pp.pushScope("unit_000");
+	for (double v : pp.getDoubleArray("EXT_PROFILE"))
+		sum += v;
+	pp.popScope();
+	pp.popScope();
+
+	pp.pushScope("solver");
+	for (double v : pp.getDoubleArray("USER_SOLUTION_TIMES"))
+		sum += v;
+	pp.popScope();
+
+	return sum;
+}
+
+/**
+ * @brief Parses the document without reading any fields
+ * @param [in] doc JSON document
+ * @return Whether the root contains an input scope
+ */
+template <typename ParamProvider_t>
+double parseOnly(const std::string& doc)
+{
+	ParamProvider_t pp(doc);
+	return pp.exists("input") ? 1.0 : 0.0;
+}
+
+template <typename Func_t>
+void benchmark(const char* name, int repetitions, std::size_t numBytes, Func_t func)
+{
+	double checksum = 0.0;
+	double best = std::numeric_limits<double>::max();
+	for (int i = 0; i < repetitions; ++i)
+	{
+		const std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		checksum += func();
+		const double elapsed = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+		best = std::min(best, elapsed);
+	}
+
+	std::cout << std::left << std::setw(36) << name << std::right << std::fixed << std::setprecision(3) << std::setw(10) << best * 1e3 << " ms"
+		<< std::setw(10) << static_cast<double>(numBytes) / best / (1024.0 * 1024.0) << " MiB/s"
+		<< "   (checksum " << std::scientific << std::setprecision(6) << checksum / repetitions << ")" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+	ProgramOptions opts;
+
+	try
+	{
+		TCLAP::CustomOutputWithoutVersion customOut("benchJsonProvider");
+		TCLAP::CmdLine cmd("Benchmark JSON parameter providers on a given or a synthetic input file", ' ', "1.0");
+		cmd.setOutput(&customOut);
+
+		cmd >> (new TCLAP::ValueArg<std::string>("i", "input", "Benchmark parsing of given JSON file (default: synthetic document)", false, "", "File"))->storeIn(&opts.fileName);
+		cmd >> (new TCLAP::ValueArg<std::size_t>("n", "elements", "Number of elements of arrays in synthetic document (default: 1000000)", false, 1000000, "Int"))->storeIn(&opts.numElements);
+		cmd >> (new TCLAP::ValueArg<int>("r", "repetitions", "Number of repetitions, best time is reported (default: 5)", false, 5, "Int"))->storeIn(&opts.repetitions);
+
+		cmd.parse(argc, argv);
+	}
+	catch (const TCLAP::ArgException &e)
+	{
+		std::cerr << "ERROR: " << e.error() << " for argument " << e.argId() << std::endl;
+		return 1;
+	}
+
+	std::string doc;
+	if (opts.fileName.empty())
+		doc = createDocument(opts.numElements);
+	else
+	{
+		std::ifstream ifs(opts.fileName, std::ios::in | std::ios::binary);
+		if (!ifs.good())
+		{
+			std::cerr << "ERROR: Could not open file " << opts.fileName << std::endl;
+			return 1;
+		}
+
+		std::ostringstream oss;
+		oss << ifs.rdbuf();
+		doc = oss.str();
+	}
+
+	std::cout << "Document size: " << doc.size() << " bytes" << std::endl;
+
+	benchmark("JsonParameterProvider parse", opts.repetitions, doc.size(), [&]() { return parseOnly<cadet::JsonParameterProvider>(doc); });
+	benchmark("CompactJsonParameterProvider parse", opts.repetitions, doc.size(), [&]() { return parseOnly<cadet::CompactJsonParameterProvider>(doc); });
+
+	if (opts.fileName.empty())
+	{
+		benchmark("JsonParameterProvider read", opts.repetitions, doc.size(), [&]() { return parseAndRead<cadet::JsonParameterProvider>(doc); });
+		benchmark("CompactJsonParameterProvider read", opts.repetitions, doc.size(), [&]() { return parseAndRead<cadet::CompactJsonParameterProvider>(doc); });
+	}
+
+	return 0;
+}
@@ -0,0 +1,100 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include <catch.hpp>
+#include "Approx.hpp"
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+#include "nonlin/AndersonAcceleration.hpp"
+
+namespace
+{
+	/**
+	 * @brief Affine contraction @f$ F(x) = Ax + b @f$ with slowly decaying modes
+	 * @param [in] x Point
+	 * @param [out] fx Image of @p x
+	 */
+	inline void affineMap(const std::vector<double>& x, std::vector<double>& fx)
+	{
+		const unsigned int n = x.size();
+		for (unsigned int i = 0; i < n; ++i)
+		{
+			// Lower bidiagonal matrix with eigenvalues close to 1
+			fx[i] = (0.99 - 0.05 * i / n) * x[i] + 1.0 + 0.1 * i;
+			if (i > 0)
+				fx[i] += 0.01 * x[i - 1];
+		}
+	}
+
+	/**
+	 * @brief Runs the (accelerated) fixed-point iteration until the residual falls below the tolerance
+	 * @param [in] depth Depth of the Anderson acceleration
+	 * @param [out] x Fixed point
+	 * @return Number of iterations
+	 */
+	inline unsigned int iterateToFixedPoint(unsigned int depth, std::vector<double>& x)
+	{
+		const unsigned int n = 10;
+		cadet::nonlin::AndersonAcceleration aa(n, depth);
+
+		x.assign(n, 0.0);
+		std::vector<double> fx(n, 0.0);
+		for (unsigned int iter = 1; iter <= 10000; ++iter)
+		{
+			affineMap(x, fx);
+
+			double res = 0.0;
+			for (unsigned int i = 0; i < n; ++i)
+				res = std::max(res, std::abs(fx[i] - x[i]));
+
+			if (res <= 1e-10)
+				return iter;
+
+			aa.update(x.data(), fx.data());
+		}
+		return 10000;
+	}
+}
+
+TEST_CASE("AndersonAcceleration without history is fixed-point iteration", "[AndersonAcceleration],[Nonlin]")
+{
+	cadet::nonlin::AndersonAcceleration aa(3, 0);
+	std::vector<double> x = {1.0, 2.0, 3.0};
+	const std::vector<double> fx = {4.0, 5.0, 6.0};
+
+	aa.update(x.data(), fx.data());
+	CHECK(x == fx);
+	CHECK(aa.historyLength() == 0);
+}
+
+TEST_CASE("AndersonAcceleration converges to fixed point faster than fixed-point iteration", "[AndersonAcceleration],[Nonlin]")
+{
+	std::vector<double> xPicard;
+	std::vector<double> xAnderson;
+	const unsigned int itPicard = iterateToFixedPoint(0, xPicard);
+	const unsigned int itAnderson = iterateToFixedPoint(5, xAnderson);
+
+	CAPTURE(itPicard);
+	CAPTURE(itAnderson);
+	REQUIRE(itPicard < 10000);
+	REQUIRE(itAnderson < 10000);
+	CHECK(itAnderson * 5 < itPicard);
+
+	for (unsigned int i = 0; i < xPicard.size(); ++i)
+	{
+		CAPTURE(i);
+		CHECK(xAnderson[i] == cadet::test::makeApprox(xPicard[i], 1e-6, 1e-6));
+	}
+}
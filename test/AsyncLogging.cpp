@@ -0,0 +1,222 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include <catch.hpp>
+
+#include "Logging.hpp"
+#include "LoggingUtils.hpp"
+#include "AsyncLogWriter.hpp"
+
+#include <vector>
+#include <string>
+#include <thread>
+
+namespace
+{
+	struct CollectingSink
+	{
+		std::vector<cadet::log::LogRecord>* records;
+
+		inline void operator()(const cadet::log::LogRecord& rec) const
+		{
+			records->push_back(rec);
+		}
+	};
+
+	class CollectingReceiver : public cadet::ILogReceiver
+	{
+	public:
+		virtual void message(const char* file, const char* func, const unsigned int line, cadet::LogLevel lvl, const char* lvlStr, const char* message)
+		{
+			messages.push_back(message);
+		}
+
+		std::vector<std::string> messages;
+	};
+}
+
+TEST_CASE("LogRecordQueue preserves order and rejects records when full", "[Logging]")
+{
+	cadet::log::LogRecordQueue queue(3);
+	REQUIRE(queue.capacity() == 4);
+
+	for (int i = 0; i < 4; ++i)
+		CHECK(queue.tryPush(__FILE__, __func__, i, cadet::LogLevel::Info, std::to_string(i).c_str()));
+	CHECK_FALSE(queue.tryPush(__FILE__, __func__, 4, cadet::LogLevel::Info, "4"));
+
+	cadet::log::LogRecord rec;
+	for (int i = 0; i < 4; ++i)
+	{
+		REQUIRE(queue.tryPop(rec));
+		CHECK(rec.line == static_cast<unsigned int>(i));
+		CHECK(rec.message == std::to_string(i));
+
+		// Slots are reused after popping
+		CHECK(queue.tryPush(__FILE__, __func__, i + 4, cadet::LogLevel::Info, std::to_string(i + 4).c_str()));
+	}
+
+	for (int i = 4; i < 8; ++i)
+	{
+		REQUIRE(queue.tryPop(rec));
+		CHECK(rec.message == std::to_string(i));
+	}
+	CHECK_FALSE(queue.tryPop(rec));
+}
+
+TEST_CASE("AsyncLogWriter delivers records of multiple threads", "[Logging]")
+{
+	const int nThreads = 4;
+	const int nRecords = 2000;
+
+	std::vector<cadet::log::LogRecord> records;
+	std::uint64_t numDropped = 0;
+	{
+		cadet::log::AsyncLogWriter<CollectingSink> writer(1024, CollectingSink{&records});
+
+		std::vector<std::thread> threads;
+		for (int t = 0; t < nThreads; ++t)
+		{
+			threads.emplace_back([&writer, t]()
+			{
+				for (int i = 0; i < nRecords; ++i)
+					writer.push(__FILE__, __func__, t * nRecords + i, cadet::LogLevel::Debug, "msg");
+			});
+		}
+
+		for (std::thread& th : threads)
+			th.join();
+
+		writer.flush();
+		numDropped = writer.numDropped();
+	}
+
+	// Each delivered record of a thread appears in order of emission
+	std::vector<int> lastLine(nThreads, -1);
+	std::uint64_t numDelivered = 0;
+	for (const cadet::log::LogRecord& rec : records)
+	{
+		if (rec.lvl == cadet::LogLevel::Warning)
+			continue;
+
+		const int t = rec.line / nRecords;
+		CHECK(static_cast<int>(rec.line) > lastLine[t]);
+		lastLine[t] = rec.line;
+		++numDelivered;
+	}
+
+	CHECK(numDelivered + numDropped == static_cast<std::uint64_t>(nThreads * nRecords));
+}
+
+TEST_CASE("AsyncLogWriter reports dropped records", "[Logging]")
+{
+	std::vector<cadet::log::LogRecord> records;
+	std::uint64_t numDropped = 0;
+	{
+		cadet::log::AsyncLogWriter<CollectingSink> writer(2, CollectingSink{&records});
+
+		for (int i = 0; i < 1000; ++i)
+			writer.push(__FILE__, __func__, i, cadet::LogLevel::Debug, "msg");
+
+		writer.flush();
+		numDropped = writer.numDropped();
+	}
+
+	if (numDropped > 0)
+	{
+		REQUIRE(!records.empty());
+		bool reported = false;
+		for (const cadet::log::LogRecord& rec : records)
+			reported = reported || ((rec.lvl == cadet::LogLevel::Warning) && (rec.message.find("Dropped") != std::string::npos));
+		CHECK(reported);
+	}
+	CHECK(records.size() + numDropped >= 1000);
+}
+
+TEST_CASE("Asynchronous logging delivers all messages to the receiver", "[Logging]")
+{
+	CollectingReceiver recv;
+	cadet::setLogReceiver(&recv);
+	cadet::setAsyncLogging(true, 1024);
+
+	for (int i = 0; i < 100; ++i)
+		cadet::log::emitLog(__FILE__, __func__, __LINE__, cadet::LogLevel::Warning, std::to_string(i).c_str());
+
+	cadet::log::emitLog(__FILE__, __func__, __LINE__, cadet::LogLevel::Error, "error");
+	CHECK(recv.messages.size() == 101);
+
+	cadet::setAsyncLogging(false, 0);
+	cadet::setLogReceiver(nullptr);
+
+	REQUIRE(recv.messages.size() == 101);
+	for (int i = 0; i < 100; ++i)
+		CHECK(recv.messages[i] == std::to_string(i));
+	CHECK(recv.messages.back() == "error");
+}
+
+TEST_CASE("AsyncLogWriter formats deferred arrays on the background thread", "[Logging]")
+{
+	std::vector<cadet::log::LogRecord> records;
+	{
+		cadet::log::AsyncLogWriter<CollectingSink> writer(4, CollectingSink{&records});
+
+		cadet::log::LogRecord rec;
+		rec.file = __FILE__;
+		rec.func = __func__;
+		rec.line = __LINE__;
+		rec.lvl = cadet::LogLevel::Warning;
+		rec.message = "a = , b = \n";
+		rec.values = {1.0, 2.5, 3.0, 7.0};
+		rec.arrays.push_back(cadet::log::DeferredArray{4, 0, 3, 6, std::ios_base::dec, false});
+		rec.arrays.push_back(cadet::log::DeferredArray{10, 3, 1, 6, std::ios_base::dec, true});
+
+		REQUIRE(writer.push(rec));
+		writer.flush();
+	}
+
+	REQUIRE(records.size() == 1);
+	CHECK(records[0].message == "a = [1,2.5,3], b = [7]\n");
+	CHECK(records[0].values.empty());
+	CHECK(records[0].arrays.empty());
+}
+
+TEST_CASE("Logged arrays are formatted identically in synchronous and asynchronous mode", "[Logging]")
+{
+	const cadet::LogLevel oldLvl = cadet::getLogLevel();
+	cadet::setLogLevel(cadet::LogLevel::Warning);
+
+	CollectingReceiver recv;
+	cadet::setLogReceiver(&recv);
+
+	std::vector<double> values = {1.0, 0.125, 1e-10, 123456789.0};
+	const std::vector<unsigned int> indices = {0, 4000000, 7};
+
+	for (int async = 0; async < 2; ++async)
+	{
+		cadet::setAsyncLogging(async == 1, 1024);
+		LOG(Warning) << "values = " << cadet::log::VectorPtr<double>(values.data(), values.size()) << " idx = "
+			<< cadet::log::VectorPtr<unsigned int>(indices.data(), indices.size()) << " empty = "
+			<< cadet::log::VectorPtr<double>(values.data(), 0);
+
+		// Raw values have been copied
+		values[0] = -1.0;
+		cadet::flushLog();
+		values[0] = 1.0;
+	}
+
+	cadet::setAsyncLogging(false, 0);
+	cadet::setLogReceiver(nullptr);
+	cadet::setLogLevel(oldLvl);
+
+	REQUIRE(recv.messages.size() == 2);
+	CHECK(recv.messages[0] == "values = [1,0.125,1e-10,1.23457e+08] idx = [0,4000000,7] empty = []\n");
+	CHECK(recv.messages[1] == recv.messages[0]);
+}
@@ -124,6 +124,43 @@ TEST_CASE("FactorizableBandMatrix solves", "[BandMatrix],[LinAlg]")
 	REQUIRE(cadet::linalg::linfNorm(y.data(), y.size()) <= 1e-10);
 }
 
+TEST_CASE("FactorizableBandMatrix solves multiple right hand sides", "[BandMatrix],[LinAlg]")
+{
+	using cadet::linalg::FactorizableBandMatrix;
+	using cadet::linalg::BandMatrix;
+
+	const BandMatrix bm = cadet::test::createBandMatrix<BandMatrix>(10, 2, 3);
+	FactorizableBandMatrix fbm = fromBandMatrix(bm);
+
+	REQUIRE(fbm.factorize());
+
+	// Prepare some right hand sides stored consecutively
+	const unsigned int nRhs = 3;
+	std::vector<double> y(fbm.rows() * nRhs, 0.0);
+	for (unsigned int r = 0; r < nRhs; ++r)
+	{
+		for (unsigned int i = 0; i < fbm.rows(); ++i)
+			y[r * fbm.rows() + i] = std::sin(6.283185307 * (i + r) / static_cast<double>(fbm.rows())) + r;
+	}
+
+	// Solve all at once
+	std::vector<double> x = y;
+	REQUIRE(fbm.solve(x.data(), nRhs));
+
+	// Compare with single solves and check residual
+	for (unsigned int r = 0; r < nRhs; ++r)
+	{
+		std::vector<double> xSingle(y.begin() + r * fbm.rows(), y.begin() + (r + 1) * fbm.rows());
+		REQUIRE(fbm.solve(xSingle.data()));
+
+		for (unsigned int i = 0; i < fbm.rows(); ++i)
+			CHECK(x[r * fbm.rows() + i] == xSingle[i]);
+
+		bm.multiplyVector(x.data() + r * fbm.rows(), 1.0, -1.0, y.data() + r * fbm.rows());
+		REQUIRE(cadet::linalg::linfNorm(y.data() + r * fbm.rows(), fbm.rows()) <= 1e-10);
+	}
+}
+
 /**
  * @brief Tests the extraction of a dense submatrix via submatrixMultiplyVector()
  * @details Combines extractDenseSubMatrix() with checkMatrixAgainstLinearArray().
@@ -21,11 +21,14 @@
 #include "JsonTestModels.hpp"
 #include "SimHelper.hpp"
 #include "ParticleHelper.hpp"
+#include "UnitOperationTests.hpp"
 #include "common/Driver.hpp"
 #include "model/UnitOperation.hpp"
 #include "SimulationTypes.hpp"
 
 #include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <functional>
 #include <vector>
 #include <algorithm>
@@ -159,6 +162,259 @@ TEST_CASE("CSTR vs analytic solution (V constant) w/o binding model", "[CSTR],[S
 	});
 }
 
+TEST_CASE("CSTR resume from checkpoint matches uninterrupted simulation", "[CSTR],[Simulation],[Checkpoint]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(3, 119.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 10.0, 100.0, 119.0});
+	cadet::test::setInitialConditions(jpp, {0.0}, {}, 10.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 1, 0, 1.0, -1.0 / 90.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 2, 0, 0.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 1.0, 0.5, 0.5);
+	cadet::test::setFlowRates(jpp, 1, 1.0, 0.5, 0.5);
+	cadet::test::setFlowRates(jpp, 2, 1.0, 0.5, 0.5);
+
+	const char* const fileName = "cadet-test-checkpoint.bin";
+
+	// Run complete simulation and write checkpoints (the last one is at the start of the last section)
+	cadet::Driver drvFull;
+	drvFull.configure(jpp);
+	drvFull.simulator()->setCheckpointFile(fileName);
+	drvFull.run();
+
+	unsigned int lenFull = 0;
+	double const* const solFull = drvFull.simulator()->getLastSolution(lenFull);
+
+	// Resume from checkpoint
+	cadet::Driver drvResume;
+	drvResume.configure(jpp);
+	drvResume.simulator()->resumeFromCheckpoint(fileName);
+	drvResume.run();
+
+	unsigned int lenResume = 0;
+	double const* const solResume = drvResume.simulator()->getLastSolution(lenResume);
+
+	std::remove(fileName);
+
+	REQUIRE(lenFull == lenResume);
+	for (unsigned int i = 0; i < lenFull; ++i)
+	{
+		CAPTURE(i);
+		CHECK(solResume[i] == cadet::test::makeApprox(solFull[i], 1e-8, 1e-10));
+	}
+}
+
+TEST_CASE("CSTR checkpoints do not alter time integration", "[CSTR],[Simulation],[Checkpoint]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(3, 119.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 10.0, 100.0, 119.0});
+	cadet::test::setInitialConditions(jpp, {0.0}, {}, 10.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 1, 0, 1.0, -1.0 / 90.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 2, 0, 0.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 1.0, 0.5, 0.5);
+	cadet::test::setFlowRates(jpp, 1, 1.0, 0.5, 0.5);
+	cadet::test::setFlowRates(jpp, 2, 1.0, 0.5, 0.5);
+
+	const char* const fileName = "cadet-test-checkpoint-interval.bin";
+
+	cadet::Driver drvPlain;
+	drvPlain.configure(jpp);
+	drvPlain.run();
+
+	// Checkpoint at every section transition
+	cadet::Driver drvCheckpoint;
+	drvCheckpoint.configure(jpp);
+	drvCheckpoint.simulator()->setCheckpointFile(fileName);
+	drvCheckpoint.run();
+
+	CHECK(std::ifstream(fileName).good());
+	std::remove(fileName);
+
+	// The interval has not elapsed at any section transition, so no checkpoint is written
+	cadet::Driver drvThrottled;
+	drvThrottled.configure(jpp);
+	drvThrottled.simulator()->setCheckpointFile(fileName);
+	drvThrottled.simulator()->setCheckpointInterval(1e6);
+	drvThrottled.run();
+
+	CHECK_FALSE(std::ifstream(fileName).good());
+	std::remove(fileName);
+
+	// Checkpoints are taken at restart points of the time integrator and yield the same results
+	const cadet::InternalStorageUnitOpRecorder* const plain = drvPlain.solution()->unitOperation(0);
+	for (const cadet::Driver* drv : {&drvCheckpoint, &drvThrottled})
+	{
+		const cadet::InternalStorageUnitOpRecorder* const rec = drv->solution()->unitOperation(0);
+		REQUIRE(rec->numDataPoints() == plain->numDataPoints());
+		for (unsigned int i = 0; i < plain->numDataPoints(); ++i)
+		{
+			CAPTURE(i);
+			CHECK(rec->outlet()[i] == plain->outlet()[i]);
+		}
+	}
+}
+
+TEST_CASE("CSTR cyclic steady state iteration yields periodic solution", "[CSTR],[Simulation],[CSS]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(2, 20.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 10.0, 20.0});
+	cadet::test::setInitialConditions(jpp, {0.0}, {}, 10.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 1, 0, 0.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 1.0, 1.0, 0.0);
+	cadet::test::setFlowRates(jpp, 1, 1.0, 1.0, 0.0);
+
+	jpp.pushScope("solver");
+	jpp.set("CSS_MAX_CYCLES", 100);
+	jpp.set("CSS_TOL", 1e-10);
+	jpp.popScope();
+
+	cadet::Driver drv;
+	drv.configure(jpp);
+	drv.run();
+
+	// Periodic solution c(0) = c(20) with analytic value c(0) = e^(-1) / (1 + e^(-1))
+	cadet::InternalStorageUnitOpRecorder const* const simData = drv.solution()->unitOperation(0);
+	double const* const outlet = simData->outlet();
+	const double cStart = std::exp(-1.0) / (1.0 + std::exp(-1.0));
+
+	CHECK(outlet[0] == cadet::test::makeApprox(cStart, 1e-6, 1e-8));
+	CHECK(outlet[simData->numDataPoints() - 1] == cadet::test::makeApprox(cStart, 1e-6, 1e-8));
+}
+
+namespace
+{
+	/**
+	 * @brief Stops the feed when the CSTR outlet concentration reaches a threshold
+	 */
+	class FeedStopEventHandler : public cadet::IEventHandler
+	{
+	public:
+		FeedStopEventHandler(double threshold) : _threshold(threshold), _eventTime(-1.0) { }
+
+		virtual unsigned int numEvents() const CADET_NOEXCEPT { return 1; }
+
+		virtual void evaluateEvents(double t, unsigned int secIdx, const cadet::IEventState& state, double* const g)
+		{
+			g[0] = state.outletConcentration(0, 0, 0) - _threshold;
+		}
+
+		virtual bool handleEvents(double t, unsigned int secIdx, int const* events, const cadet::IEventState& state, cadet::IModelSystem& model)
+		{
+			if (events[0] == 0)
+				return false;
+
+			_eventTime = t;
+			model.setParameter(cadet::makeParamId("CONST_COEFF", 1, 0, cadet::ParTypeIndep, cadet::BoundStateIndep, cadet::ReactionIndep, 0), 0.0);
+			return true;
+		}
+
+		double eventTime() const { return _eventTime; }
+
+	protected:
+		double _threshold;
+		double _eventTime;
+	};
+
+	/**
+	 * @brief Queries the outlet of a unit operation that does not exist
+	 */
+	class InvalidOutletEventHandler : public cadet::IEventHandler
+	{
+	public:
+		virtual unsigned int numEvents() const CADET_NOEXCEPT { return 1; }
+
+		virtual void evaluateEvents(double t, unsigned int secIdx, const cadet::IEventState& state, double* const g)
+		{
+			g[0] = state.outletConcentration(5, 0, 0);
+		}
+
+		virtual bool handleEvents(double t, unsigned int secIdx, int const* events, const cadet::IEventState& state, cadet::IModelSystem& model)
+		{
+			return false;
+		}
+	};
+}
+
+TEST_CASE("CSTR event handler stops feed at outlet concentration threshold", "[CSTR],[Simulation],[Events]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(1, 50.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 50.0});
+	cadet::test::setInitialConditions(jpp, {0.0}, {}, 10.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 1.0, 1.0, 0.0);
+
+	FeedStopEventHandler eh(0.5);
+
+	cadet::Driver drv;
+	drv.configure(jpp);
+	drv.simulator()->setEventHandler(&eh);
+	drv.run();
+
+	// Analytic solution: c(t) = 1 - exp(-t / 10) until c(t*) = 0.5, then c(t) = 0.5 * exp(-(t - t*) / 10)
+	const double tEvent = 10.0 * std::log(2.0);
+	CHECK(eh.eventTime() == cadet::test::makeApprox(tEvent, 1e-6, 1e-6));
+
+	cadet::InternalStorageUnitOpRecorder const* const simData = drv.solution()->unitOperation(0);
+	double const* outlet = simData->outlet();
+	double const* time = drv.solution()->time();
+
+	for (unsigned int i = 0; i < simData->numDataPoints(); ++i, ++outlet, ++time)
+	{
+		CAPTURE(*time);
+		const double ref = (*time <= tEvent) ? -std::expm1(-(*time) / 10.0) : 0.5 * std::exp(-(*time - tEvent) / 10.0);
+		CHECK((*outlet) == cadet::test::makeApprox(ref, 1e-5, 1e-5));
+	}
+}
+
+TEST_CASE("CSTR exception in event function is propagated from time integration", "[CSTR],[Simulation],[Events]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(1, 50.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 50.0});
+	cadet::test::setInitialConditions(jpp, {0.0}, {}, 10.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 1.0, 1.0, 0.0);
+
+	InvalidOutletEventHandler eh;
+
+	cadet::Driver drv;
+	drv.configure(jpp);
+	drv.simulator()->setEventHandler(&eh);
+	CHECK_THROWS_AS(drv.run(), cadet::InvalidParameterException);
+}
+
+TEST_CASE("CSTR dense output vs analytic solution (V constant) w/o binding model", "[CSTR],[Simulation],[DenseOutput]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(3, 119.0, 0.1);
+	cadet::test::setSectionTimes(jpp, {0.0, 10.0, 100.0, 119.0});
+	cadet::test::setInitialConditions(jpp, {0.0}, {}, 10.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 1, 0, 1.0, -1.0 / 90.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 2, 0, 0.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 1.0, 0.5, 0.5);
+	cadet::test::setFlowRates(jpp, 1, 1.0, 0.5, 0.5);
+	cadet::test::setFlowRates(jpp, 2, 1.0, 0.5, 0.5);
+
+	jpp.pushScope("solver");
+	jpp.set("DENSE_OUTPUT", true);
+	jpp.popScope();
+
+	const double temp = 10.0 * (9.0 + 2.0 * std::sqrt(std::exp(1.0)));
+	const double temp2 = 2.0 / 9.0 * (-9.0 - 2.0 * std::sqrt(std::exp(1.0)) + 2 * std::exp(5));
+	runSim(jpp, [=](double t) {
+			if (t <= 10.0)
+				return -2.0 * std::expm1(-t / 20.0);
+			else if (t <= 100.0)
+				return (120.0 - temp * std::exp(-t / 20.0) - t)  / 45.0;
+			else
+				return std::exp(-5.0 - (t - 100.0) / 20.0) * temp2;
+		}, 
+		[](double t) {
+			return 10.0;
+	});
+}
+
 TEST_CASE("CSTR vs analytic solution (V increasing) w/o binding model", "[CSTR],[Simulation]")
 {
 	cadet::JsonParameterProvider jpp = createCSTRBenchmark(1, 100.0, 1.0);
@@ -264,6 +520,25 @@ TEST_CASE("CSTR filter flowrate sensitivity vs analytic solution (V constant) w/
 	});
 }
 
+#ifdef CADET_ALLOCATION_TRACKING
+TEST_CASE("CSTR time integration with sensitivities is allocation free", "[CSTR],[Simulation],[Sensitivity],[Allocation]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(3, 119.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 10.0, 100.0, 119.0});
+	cadet::test::setInitialConditions(jpp, {0.0}, {}, 10.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 1, 0, 1.0, -1.0 / 90.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 2, 0, 0.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 1.0, 0.5, 0.5);
+	cadet::test::setFlowRates(jpp, 1, 1.0, 0.5, 0.5);
+	cadet::test::setFlowRates(jpp, 2, 1.0, 0.5, 0.5);
+	setFlowRateFilter(jpp, 0.5);
+	cadet::test::addSensitivity(jpp, "FLOWRATE_FILTER", cadet::makeParamId("FLOWRATE_FILTER", 0, cadet::CompIndep, cadet::ParTypeIndep, cadet::BoundStateIndep, cadet::ReactionIndep, cadet::SectionIndep), 1e-6);
+
+	cadet::test::unitoperation::testSimulationAllocationFree(jpp);
+}
+#endif
+
 TEST_CASE("CSTR LIN_COEFF sensitivity vs analytic solution (V constant) w/o binding model", "[CSTR],[Simulation],[AD],[Sensitivity]")
 {
 	cadet::JsonParameterProvider jpp = createCSTRBenchmark(1, 100.0, 1.0);
@@ -26,6 +26,7 @@
 #include "linalg/Norms.hpp"
 #include "SimulationTypes.hpp"
 #include "ParallelSupport.hpp"
+#include "AllocationTracker.hpp"
 
 #include "JsonTestModels.hpp"
 #include "JacobianHelper.hpp"
@@ -1049,6 +1050,124 @@ namespace column
 		destroyModelBuilder(mb);
 	}
 
+	void testLinearSolverStatistics(const std::string& uoType)
+	{
+		cadet::IModelBuilder* const mb = cadet::createModelBuilder();
+		REQUIRE(nullptr != mb);
+
+		// Use some test case parameters
+		cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding(uoType);
+		cadet::IUnitOperation* const unit = createAndConfigureUnit(uoType, *mb, jpp, cadet::Weno::maxOrder());
+
+		cadet::util::ThreadLocalStorage tls;
+		tls.resize(unit->threadLocalMemorySize());
+
+		// Setup matrices
+		unit->notifyDiscontinuousSectionTransition(0.0, 0u, AdJacobianParams{nullptr, nullptr, 0u});
+
+		const unsigned int nDof = unit->numDofs();
+		std::vector<double> y(nDof, 0.0);
+		std::vector<double> yDot(nDof, 0.0);
+		std::vector<double> res(nDof, 0.0);
+		std::vector<double> weight(nDof, 1.0);
+
+		util::populate(y.data(), [=](unsigned int idx) { return std::abs(std::sin(idx * 0.13)) + 1e-4; }, nDof);
+		util::populate(yDot.data(), [=](unsigned int idx) { return std::abs(std::sin((idx + nDof) * 0.13)) + 1e-4; }, nDof);
+
+		const SimulationTime simTime{0.0, 0u};
+		const ConstSimulationState simState{y.data(), yDot.data()};
+
+		const cadet::LinearSolverStatistics initial = unit->linearSolverStatistics();
+		CHECK(initial.numFactorizations == 0);
+		CHECK(initial.numGmresIterations == 0);
+
+		// Factorize once per Jacobian update
+		unit->residualWithJacobian(simTime, simState, res.data(), AdJacobianParams{nullptr, nullptr, 0u}, tls);
+		REQUIRE(unit->linearSolve(0.0, 1.0, 1e-8, res.data(), weight.data(), simState) == 0);
+		REQUIRE(unit->linearSolve(0.0, 1.0, 1e-8, res.data(), weight.data(), simState) == 0);
+		CHECK(unit->linearSolverStatistics().numFactorizations == 1);
+
+		unit->residualWithJacobian(simTime, simState, res.data(), AdJacobianParams{nullptr, nullptr, 0u}, tls);
+		REQUIRE(unit->linearSolve(0.0, 1.0, 1e-8, res.data(), weight.data(), simState) == 0);
+
+		CHECK(unit->linearSolverStatistics().numFactorizations == 2);
+
+		mb->destroyUnitOperation(unit);
+		destroyModelBuilder(mb);
+	}
+
+#ifdef CADET_ALLOCATION_TRACKING
+	void testHotPathAllocationFree(const std::string& uoType)
+	{
+		cadet::IModelBuilder* const mb = cadet::createModelBuilder();
+		REQUIRE(nullptr != mb);
+
+		// Use some test case parameters
+		cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding(uoType);
+
+		for (int bindMode = 0; bindMode < 2; ++bindMode)
+		{
+			const bool isKinetic = bindMode;
+			SECTION(isKinetic ? "Kinetic binding" : "Quasi-stationary binding")
+			{
+				cadet::test::setBindingMode(jpp, isKinetic);
+
+				cadet::IUnitOperation* const unit = createAndConfigureUnit(uoType, *mb, jpp, cadet::Weno::maxOrder());
+
+				cadet::util::ThreadLocalStorage tls;
+				tls.resize(unit->threadLocalMemorySize());
+
+				// Setup matrices
+				unit->notifyDiscontinuousSectionTransition(0.0, 0u, AdJacobianParams{nullptr, nullptr, 0u});
+
+				// Obtain memory for state, residual, and linear solver
+				const unsigned int nDof = unit->numDofs();
+				std::vector<double> y(nDof, 0.0);
+				std::vector<double> yDot(nDof, 0.0);
+				std::vector<double> res(nDof, 0.0);
+				std::vector<double> weight(nDof, 1.0);
+
+				// Fill state vectors with some values
+				util::populate(y.data(), [=](unsigned int idx) { return std::abs(std::sin(idx * 0.13)) + 1e-4; }, nDof);
+				util::populate(yDot.data(), [=](unsigned int idx) { return std::abs(std::sin((idx + nDof) * 0.13)) + 1e-4; }, nDof);
+
+				const SimulationTime simTime{0.0, 0u};
+				const ConstSimulationState simState{y.data(), yDot.data()};
+
+				// Warmup calls may initialize lazily allocated buffers
+				unit->residualWithJacobian(simTime, simState, res.data(), AdJacobianParams{nullptr, nullptr, 0u}, tls);
+				unit->linearSolve(0.0, 1.0, 1e-8, res.data(), weight.data(), simState);
+
+				// Measure allocations of subsequent calls
+				// Calls must not fail since errors are logged, which allocates memory
+				unsigned int numFailed = 0;
+				const cadet::util::AllocationCounter counter;
+				for (unsigned int i = 0; i < 5; ++i)
+				{
+					numFailed += (unit->residualWithJacobian(simTime, simState, res.data(), AdJacobianParams{nullptr, nullptr, 0u}, tls) != 0);
+					numFailed += (unit->linearSolve(0.0, 1.0, 1e-8, res.data(), weight.data(), simState) != 0);
+					numFailed += (unit->residual(simTime, simState, res.data(), tls) != 0);
+				}
+				const std::uint64_t numAllocs = counter.count();
+
+				REQUIRE(numFailed == 0);
+				CHECK(numAllocs == 0);
+
+				mb->destroyUnitOperation(unit);
+			}
+		}
+		destroyModelBuilder(mb);
+	}
+
+	void testSimulationAllocationFree(const std::string& uoType)
+	{
+		cadet::JsonParameterProvider jpp = createLWE(uoType);
+		cadet::test::addSensitivity(jpp, "COL_DISPERSION", cadet::makeParamId("COL_DISPERSION", 0, cadet::CompIndep, cadet::ParTypeIndep, cadet::BoundStateIndep, cadet::ReactionIndep, cadet::SectionIndep), 1e-12);
+		cadet::test::addSensitivity(jpp, "SMA_KA", cadet::makeParamId("SMA_KA", 0, 1, cadet::ParTypeIndep, 0, cadet::ReactionIndep, cadet::SectionIndep), 1e-6);
+		cadet::test::unitoperation::testSimulationAllocationFree(jpp);
+	}
+#endif
+
 } // namespace column
 } // namespace test
 } // namespace cadet
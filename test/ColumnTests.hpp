@@ -253,6 +253,32 @@ namespace column
 	 */
 	void testInletDofJacobian(const std::string& uoType);
 
+	/**
+	 * @brief Checks the linear solver statistics of a unit operation
+	 * @details The Jacobian is only factorized in the first linear solve after it has been updated
+	 *          by a residual evaluation.
+	 * @param [in] uoType Unit operation type
+	 */
+	void testLinearSolverStatistics(const std::string& uoType);
+
+#ifdef CADET_ALLOCATION_TRACKING
+	/**
+	 * @brief Checks that residual and linear solver calls do not allocate heap memory
+	 * @details After some warmup calls, the residual (with and without Jacobian) and the linear
+	 *          solver are evaluated repeatedly. No heap allocations are allowed in these calls.
+	 *          Both binding modes are checked.
+	 * @param [in] uoType Unit operation type
+	 */
+	void testHotPathAllocationFree(const std::string& uoType);
+
+	/**
+	 * @brief Checks that the time integration of the load-wash-elution example with sensitivities does not allocate heap memory
+	 * @details See cadet::test::unitoperation::testSimulationAllocationFree().
+	 * @param [in] uoType Unit operation type
+	 */
+	void testSimulationAllocationFree(const std::string& uoType);
+#endif
+
 } // namespace column
 } // namespace test
 } // namespace cadet
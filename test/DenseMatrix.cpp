@@ -169,6 +169,32 @@ TEST_CASE("DenseMatrix LU solves", "[DenseMatrix],[LinAlg]")
 	REQUIRE(cadet::linalg::linfNorm(y.data(), y.size()) <= 1e-13);
 }
 
+TEST_CASE("DenseMatrix LU solves multiple right hand sides", "[DenseMatrix],[LinAlg]")
+{
+	using cadet::linalg::DenseMatrix;
+
+	// Probability of obtaining a non-invertible random matrix is 0
+	const DenseMatrix dm = randomMatrix(8, 8);
+	DenseMatrix fdm = dm;
+
+	REQUIRE(fdm.factorize());
+
+	// Prepare some right hand sides stored consecutively
+	const unsigned int nRhs = 4;
+	std::vector<double> y = randomVector(dm.rows() * nRhs);
+
+	// Solve all at once
+	std::vector<double> x = y;
+	REQUIRE(fdm.solve(x.data(), nRhs));
+
+	// Calculate residual in y for each right hand side
+	for (unsigned int r = 0; r < nRhs; ++r)
+	{
+		dm.multiplyVector(x.data() + r * dm.rows(), 1.0, -1.0, y.data() + r * dm.rows());
+		REQUIRE(cadet::linalg::linfNorm(y.data() + r * dm.rows(), dm.rows()) <= 1e-12);
+	}
+}
+
 TEST_CASE("DenseMatrix QR solves", "[DenseMatrix],[LinAlg]")
 {
 	using cadet::linalg::DenseMatrix;
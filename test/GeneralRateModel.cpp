@@ -141,6 +141,23 @@ TEST_CASE("GRM inlet DOF Jacobian", "[GRM],[UnitOp],[Jacobian],[Inlet]")
 	cadet::test::column::testInletDofJacobian("GENERAL_RATE_MODEL");
 }
 
+TEST_CASE("GRM linear solver statistics", "[GRM],[UnitOp],[LinearSolver]")
+{
+	cadet::test::column::testLinearSolverStatistics("GENERAL_RATE_MODEL");
+}
+
+#ifdef CADET_ALLOCATION_TRACKING
+TEST_CASE("GRM residual and linear solve are allocation free", "[GRM],[UnitOp],[Residual],[Allocation]")
+{
+	cadet::test::column::testHotPathAllocationFree("GENERAL_RATE_MODEL");
+}
+
+TEST_CASE("GRM time integration with sensitivities is allocation free", "[GRM],[Simulation],[Sensitivity],[Allocation]")
+{
+	cadet::test::column::testSimulationAllocationFree("GENERAL_RATE_MODEL");
+}
+#endif
+
 TEST_CASE("GRM LWE one vs two identical particle types match", "[GRM],[Simulation],[ParticleType]")
 {
 	cadet::test::particle::testOneVsTwoIdenticalParticleTypes("GENERAL_RATE_MODEL", 2e-8, 5e-5);
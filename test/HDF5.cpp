@@ -0,0 +1,604 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include <catch.hpp>
+
+#include "Logging.hpp"
+#include "common/JsonParameterProvider.hpp"
+#include "common/Driver.hpp"
+#include "io/hdf5/HDF5Writer.hpp"
+#include "io/hdf5/HDF5Reader.hpp"
+#include "io/hdf5/HDF5CachedReader.hpp"
+
+#include "JsonTestModels.hpp"
+#include "SimHelper.hpp"
+
+#include <vector>
+#include <string>
+#include <cstdio>
+#include <cmath>
+#include <algorithm>
+
+namespace
+{
+	const char* const writerTestFile = "testHDF5Writer.h5";
+
+	const std::size_t nRows = 10;
+	const std::size_t nCols = 20;
+
+	/**
+	 * @brief Creation properties of a dataset
+	 */
+	struct DatasetProperties
+	{
+		std::vector<H5Z_filter_t> filters; //!< Filters in order of application
+		std::vector<unsigned int> firstParam; //!< First parameter of each filter, @c 0 if the filter has no parameters
+		std::vector<hsize_t> chunks; //!< Chunk dimensions, empty if the dataset is not chunked
+		std::size_t typeSize; //!< Size of an element in the file in bytes
+	};
+
+	inline DatasetProperties datasetProperties(const std::string& path)
+	{
+		DatasetProperties dp;
+
+		const hid_t file = H5Fopen(writerTestFile, H5F_ACC_RDONLY, H5P_DEFAULT);
+		REQUIRE(file >= 0);
+		const hid_t dset = H5Dopen2(file, path.c_str(), H5P_DEFAULT);
+		REQUIRE(dset >= 0);
+
+		const hid_t type = H5Dget_type(dset);
+		dp.typeSize = H5Tget_size(type);
+		H5Tclose(type);
+
+		const hid_t plist = H5Dget_create_plist(dset);
+		if (H5Pget_layout(plist) == H5D_CHUNKED)
+		{
+			dp.chunks.resize(H5Pget_chunk(plist, 0, nullptr));
+			H5Pget_chunk(plist, dp.chunks.size(), dp.chunks.data());
+		}
+
+		const int nFilters = H5Pget_nfilters(plist);
+		for (int i = 0; i < nFilters; ++i)
+		{
+			unsigned int flags = 0;
+			unsigned int cdValues[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+			std::size_t nValues = 8;
+			unsigned int filterConfig = 0;
+			dp.filters.push_back(H5Pget_filter2(plist, i, &flags, &nValues, cdValues, 0, nullptr, &filterConfig));
+			dp.firstParam.push_back((nValues > 0) ? cdValues[0] : 0u);
+		}
+
+		H5Pclose(plist);
+		H5Dclose(dset);
+		H5Fclose(file);
+		return dp;
+	}
+
+	inline std::vector<double> testData()
+	{
+		std::vector<double> data(nRows * nCols);
+		for (std::size_t i = 0; i < data.size(); ++i)
+			data[i] = std::sin(0.1 * static_cast<double>(i)) * 100.0 + 1.0 / 3.0;
+		return data;
+	}
+
+	inline void writeTestFile(const cadet::io::StorageOptions& defaultOpts, const std::vector<cadet::io::DatasetStorageOptions>& datasetOpts,
+		const std::vector<std::string>& names, cadet::io::HDF5Writer& writer)
+	{
+		const std::vector<double> data = testData();
+
+		writer.openFile(writerTestFile, "co");
+		writer.extendibleFields(false);
+		writer.compressFields(true);
+		writer.storageOptions(defaultOpts, datasetOpts);
+
+		writer.pushGroup("unit_000");
+		for (const std::string& name : names)
+			writer.template matrix<double>(name, nRows, nCols, data);
+		writer.popGroup();
+
+		writer.closeFile();
+	}
+
+	inline std::vector<double> readTestDataset(const std::string& name)
+	{
+		cadet::io::HDF5Reader reader;
+		reader.openFile(writerTestFile, "r");
+		reader.pushGroup("unit_000");
+		const std::vector<double> data = reader.template vector<double>(name);
+		reader.closeFile();
+		return data;
+	}
+
+	inline void checkRoundTrip(const std::string& name, double tol)
+	{
+		const std::vector<double> ref = testData();
+		const std::vector<double> data = readTestDataset(name);
+		REQUIRE(data.size() == ref.size());
+		for (std::size_t i = 0; i < ref.size(); ++i)
+		{
+			CAPTURE(i);
+			if (tol == 0.0)
+				CHECK(data[i] == ref[i]);
+			else
+				CHECK(std::abs(data[i] - ref[i]) <= tol);
+		}
+	}
+}
+
+TEST_CASE("HDF5Writer default storage options", "[HDF5][StorageOptions]")
+{
+	cadet::io::HDF5Writer writer;
+	writeTestFile(cadet::io::StorageOptions(), std::vector<cadet::io::DatasetStorageOptions>(0), {"SOLUTION_BULK"}, writer);
+
+	const DatasetProperties dp = datasetProperties("/unit_000/SOLUTION_BULK");
+	CHECK(dp.typeSize == sizeof(double));
+	CHECK(dp.chunks == std::vector<hsize_t>{nRows, nCols});
+	REQUIRE(dp.filters.size() == 1);
+	CHECK(dp.filters[0] == H5Z_FILTER_DEFLATE);
+	CHECK(dp.firstParam[0] == 9);
+
+	checkRoundTrip("SOLUTION_BULK", 0.0);
+	std::remove(writerTestFile);
+}
+
+TEST_CASE("HDF5Writer applies shuffle, compression level, chunk size, and single precision", "[HDF5][StorageOptions]")
+{
+	cadet::io::StorageOptions opts;
+	opts.compression = cadet::io::Compression::Deflate;
+	opts.compressionLevel = 4;
+	opts.shuffle = true;
+	opts.precision = cadet::io::Precision::Single;
+	opts.chunkSize = 3 * nCols * sizeof(float);
+
+	cadet::io::HDF5Writer writer;
+	writeTestFile(opts, std::vector<cadet::io::DatasetStorageOptions>(0), {"SOLUTION_BULK"}, writer);
+
+	const DatasetProperties dp = datasetProperties("/unit_000/SOLUTION_BULK");
+	CHECK(dp.typeSize == sizeof(float));
+	CHECK(dp.chunks == std::vector<hsize_t>{3, nCols});
+	REQUIRE(dp.filters.size() == 2);
+	CHECK(dp.filters[0] == H5Z_FILTER_SHUFFLE);
+	CHECK(dp.filters[1] == H5Z_FILTER_DEFLATE);
+	CHECK(dp.firstParam[1] == 4);
+
+	// Relative precision of float32 is about 6e-8, values are bounded by 101
+	checkRoundTrip("SOLUTION_BULK", 1e-5);
+	std::remove(writerTestFile);
+}
+
+TEST_CASE("HDF5Writer quantizes by scale-offset filter", "[HDF5][StorageOptions]")
+{
+	cadet::io::StorageOptions opts;
+	opts.compression = cadet::io::Compression::None;
+	opts.quantizationDigits = 3;
+
+	cadet::io::HDF5Writer writer;
+	writeTestFile(opts, std::vector<cadet::io::DatasetStorageOptions>(0), {"SOLUTION_BULK"}, writer);
+
+	const DatasetProperties dp = datasetProperties("/unit_000/SOLUTION_BULK");
+	CHECK(dp.typeSize == sizeof(double));
+	CHECK(dp.chunks == std::vector<hsize_t>{nRows, nCols});
+	REQUIRE(dp.filters.size() == 1);
+	CHECK(dp.filters[0] == H5Z_FILTER_SCALEOFFSET);
+
+	checkRoundTrip("SOLUTION_BULK", 0.5e-3);
+	std::remove(writerTestFile);
+}
+
+TEST_CASE("HDF5Writer falls back to deflate if LZ4 or Zstd filter is not available", "[HDF5][StorageOptions]")
+{
+	const H5Z_filter_t filterLZ4 = 32004;
+	const H5Z_filter_t filterZstd = 32015;
+
+	cadet::io::StorageOptions optsLZ4;
+	optsLZ4.compression = cadet::io::Compression::LZ4;
+	optsLZ4.compressionLevel = 7;
+
+	cadet::io::DatasetStorageOptions dso;
+	dso.prefix = "SOLUTION_SOLID";
+	dso.options.compression = cadet::io::Compression::Zstd;
+	dso.options.compressionLevel = 5;
+
+	cadet::io::HDF5Writer writer;
+	writeTestFile(optsLZ4, {dso}, {"SOLUTION_BULK", "SOLUTION_SOLID"}, writer);
+
+	const DatasetProperties dpLZ4 = datasetProperties("/unit_000/SOLUTION_BULK");
+	if (H5Zfilter_avail(filterLZ4) > 0)
+	{
+		CHECK_FALSE(writer.compressionUnavailable(cadet::io::Compression::LZ4));
+		CHECK(dpLZ4.filters == std::vector<H5Z_filter_t>{filterLZ4});
+	}
+	else
+	{
+		CHECK(writer.compressionUnavailable(cadet::io::Compression::LZ4));
+		CHECK(dpLZ4.filters == std::vector<H5Z_filter_t>{H5Z_FILTER_SHUFFLE, H5Z_FILTER_DEFLATE});
+		CHECK(dpLZ4.firstParam[1] == 7);
+	}
+
+	const DatasetProperties dpZstd = datasetProperties("/unit_000/SOLUTION_SOLID");
+	if (H5Zfilter_avail(filterZstd) > 0)
+	{
+		CHECK_FALSE(writer.compressionUnavailable(cadet::io::Compression::Zstd));
+		CHECK(dpZstd.filters == std::vector<H5Z_filter_t>{filterZstd});
+		CHECK(dpZstd.firstParam[0] == 5);
+	}
+	else
+	{
+		CHECK(writer.compressionUnavailable(cadet::io::Compression::Zstd));
+		CHECK(dpZstd.filters == std::vector<H5Z_filter_t>{H5Z_FILTER_SHUFFLE, H5Z_FILTER_DEFLATE});
+		CHECK(dpZstd.firstParam[1] == 5);
+	}
+
+	checkRoundTrip("SOLUTION_BULK", 0.0);
+	checkRoundTrip("SOLUTION_SOLID", 0.0);
+	std::remove(writerTestFile);
+}
+
+TEST_CASE("HDF5Writer applies storage options of dataset prefix groups", "[HDF5][StorageOptions]")
+{
+	cadet::JsonParameterProvider jpp(R"json({
+		"COMPRESSION": "NONE",
+		"storage_000": {
+			"DATASET_PREFIX": "SOLUTION_SOLID",
+			"COMPRESSION": "DEFLATE",
+			"COMPRESSION_LEVEL": 2,
+			"SHUFFLE": 1
+		},
+		"storage_001": {
+			"DATASET_PREFIX": "SOLUTION_SOLID_PARTICLE",
+			"PRECISION": "SINGLE"
+		},
+		"storage_002": {
+			"DATASET_PREFIX": "unit_000",
+			"COMPRESSION": "DEFLATE"
+		}
+	})json");
+
+	cadet::io::StorageOptions defaultOpts;
+	std::vector<cadet::io::DatasetStorageOptions> datasetOpts;
+	cadet::detail::readStorageConfig(jpp, defaultOpts, datasetOpts);
+
+	REQUIRE(datasetOpts.size() == 3);
+	CHECK(defaultOpts.compression == cadet::io::Compression::None);
+
+	cadet::io::HDF5Writer writer;
+	writeTestFile(defaultOpts, datasetOpts, {"SOLUTION_BULK", "SOLUTION_SOLID", "SOLUTION_SOLID_PARTICLE_AVERAGE"}, writer);
+
+	// Default options (prefixes do not match group names)
+	const DatasetProperties dpBulk = datasetProperties("/unit_000/SOLUTION_BULK");
+	CHECK(dpBulk.typeSize == sizeof(double));
+	CHECK(dpBulk.chunks.empty());
+	CHECK(dpBulk.filters.empty());
+
+	const DatasetProperties dpSolid = datasetProperties("/unit_000/SOLUTION_SOLID");
+	CHECK(dpSolid.typeSize == sizeof(double));
+	REQUIRE(dpSolid.filters.size() == 2);
+	CHECK(dpSolid.filters[0] == H5Z_FILTER_SHUFFLE);
+	CHECK(dpSolid.filters[1] == H5Z_FILTER_DEFLATE);
+	CHECK(dpSolid.firstParam[1] == 2);
+
+	// Longest prefix wins and starts from the default options
+	const DatasetProperties dpAvg = datasetProperties("/unit_000/SOLUTION_SOLID_PARTICLE_AVERAGE");
+	CHECK(dpAvg.typeSize == sizeof(float));
+	CHECK(dpAvg.filters.empty());
+
+	checkRoundTrip("SOLUTION_BULK", 0.0);
+	checkRoundTrip("SOLUTION_SOLID", 0.0);
+	checkRoundTrip("SOLUTION_SOLID_PARTICLE_AVERAGE", 1e-5);
+	std::remove(writerTestFile);
+}
+
+namespace
+{
+	const char* const readerTestFile = "testHDF5CachedReader.h5";
+
+	// Datasets with more elements are not cached
+	const std::size_t maxCachedElements = 4;
+
+	inline void writeReaderTestFile()
+	{
+		cadet::io::HDF5Writer writer;
+		writer.openFile(readerTestFile, "co");
+
+		writer.pushGroup("input");
+		writer.pushGroup("model");
+		writer.scalar<int>("NUNITS", 2);
+
+		writer.pushGroup("unit_000");
+		writer.scalar<std::string>("UNIT_TYPE", "GENERAL_RATE_MODEL");
+		writer.scalar<int>("NCOMP", 3);
+		writer.scalar<double>("COL_LENGTH", 0.014);
+		writer.vector<double>("INIT_C", std::vector<double>{1.0, 2.0, 3.0});
+		writer.vector<int>("NBOUND", std::vector<int>{1, 0, 2});
+		writer.vector<double>("LARGE", std::vector<double>{0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0});
+		writer.matrix<double>("MATRIX", 2, 3, std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+
+		writer.pushGroup("discretization");
+		writer.scalar<int>("NCOL", 16);
+		writer.popGroup();
+
+		writer.popGroup();
+		writer.popGroup();
+		writer.popGroup();
+
+		writer.closeFile();
+	}
+
+	template <typename T>
+	inline void checkSameVector(cadet::io::HDF5Reader& ref, cadet::io::HDF5CachedReader& cached, const std::string& name)
+	{
+		CAPTURE(name);
+		CHECK(cached.vector<T>(name) == ref.vector<T>(name));
+		// Read a second time to hit the cache
+		CHECK(cached.vector<T>(name) == ref.vector<T>(name));
+
+		const std::size_t n = ref.arraySize(name);
+		for (std::size_t i = 0; i < n; ++i)
+			CHECK(cached.scalar<T>(name, i) == ref.scalar<T>(name, i));
+
+		CHECK_THROWS_AS(cached.scalar<T>(name, n), cadet::io::IOException);
+	}
+
+	inline void checkSameQueries(cadet::io::HDF5Reader& ref, cadet::io::HDF5CachedReader& cached, const std::vector<std::string>& names)
+	{
+		for (const std::string& name : names)
+		{
+			CAPTURE(name);
+			CHECK(cached.exists(name) == ref.exists(name));
+			CHECK(cached.isVector(name) == ref.isVector(name));
+			if (!ref.exists(name))
+			{
+				CHECK_THROWS_AS(ref.isGroup(name), cadet::io::IOException);
+				CHECK_THROWS_AS(cached.isGroup(name), cadet::io::IOException);
+				continue;
+			}
+
+			CHECK(cached.isGroup(name) == ref.isGroup(name));
+			if (ref.isGroup(name))
+				continue;
+
+			CHECK(cached.isString(name) == ref.isString(name));
+			CHECK(cached.isInt(name) == ref.isInt(name));
+			CHECK(cached.isDouble(name) == ref.isDouble(name));
+			CHECK(cached.arraySize(name) == ref.arraySize(name));
+			CHECK(cached.tensorDimensions(name) == ref.tensorDimensions(name));
+		}
+	}
+}
+
+TEST_CASE("HDF5CachedReader answers queries like HDF5Reader", "[HDF5][HDF5CachedReader]")
+{
+	writeReaderTestFile();
+
+	cadet::io::HDF5Reader ref;
+	cadet::io::HDF5CachedReader cached;
+	cached.maxCachedElements(maxCachedElements);
+
+	ref.openFile(readerTestFile, "r");
+	cached.openFile(readerTestFile, "r");
+
+	CHECK(cached.numIndexedItems() == 13);
+
+	const std::vector<std::string> names{"input", "model", "NUNITS", "unit_000", "unit_001", "UNIT_TYPE", "NCOMP", "COL_LENGTH",
+		"INIT_C", "NBOUND", "LARGE", "MATRIX", "discretization", "NCOL", "unit_000/NCOMP", "unit_000/discretization/NCOL"};
+
+	SECTION("Root group")
+	{
+		checkSameQueries(ref, cached, names);
+	}
+
+	SECTION("Nested groups by push and pop")
+	{
+		ref.pushGroup("input");
+		cached.pushGroup("input");
+		checkSameQueries(ref, cached, names);
+
+		ref.pushGroup("model");
+		cached.pushGroup("model");
+		checkSameQueries(ref, cached, names);
+		checkSameVector<int>(ref, cached, "NUNITS");
+		checkSameVector<int>(ref, cached, "unit_000/NCOMP");
+
+		ref.pushGroup("unit_000");
+		cached.pushGroup("unit_000");
+		checkSameQueries(ref, cached, names);
+
+		ref.pushGroup("discretization");
+		cached.pushGroup("discretization");
+		checkSameQueries(ref, cached, names);
+		checkSameVector<int>(ref, cached, "NCOL");
+
+		ref.popGroup();
+		cached.popGroup();
+		checkSameQueries(ref, cached, names);
+		checkSameVector<int>(ref, cached, "NCOMP");
+
+		ref.popGroup();
+		cached.popGroup();
+		checkSameQueries(ref, cached, names);
+		checkSameVector<int>(ref, cached, "NUNITS");
+	}
+
+	SECTION("Cached and uncached datasets")
+	{
+		ref.setGroup("/input/model/unit_000");
+		cached.setGroup("/input/model/unit_000");
+
+		checkSameVector<std::string>(ref, cached, "UNIT_TYPE");
+		checkSameVector<int>(ref, cached, "NCOMP");
+		checkSameVector<double>(ref, cached, "COL_LENGTH");
+		checkSameVector<double>(ref, cached, "INIT_C");
+		checkSameVector<int>(ref, cached, "NBOUND");
+		checkSameVector<double>(ref, cached, "MATRIX");
+
+		// Exceeds the maximum number of cached elements
+		REQUIRE(cached.arraySize("LARGE") > maxCachedElements);
+		checkSameVector<double>(ref, cached, "LARGE");
+
+		CHECK_THROWS_AS(cached.vector<double>("MISSING"), cadet::io::IOException);
+		CHECK_THROWS_AS(cached.scalar<double>("MISSING"), cadet::io::IOException);
+		CHECK_THROWS_AS(cached.scalar<int>("discretization"), cadet::io::IOException);
+	}
+
+	ref.closeFile();
+	cached.closeFile();
+	std::remove(readerTestFile);
+}
+
+TEST_CASE("Driver writes solver statistics of each time step", "[HDF5][Simulation][Statistics]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(3, 119.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 10.0, 100.0, 119.0});
+	cadet::test::setInitialConditions(jpp, {0.0}, {}, 10.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 1, 0, 1.0, -1.0 / 90.0, 0.0, 0.0);
+	cadet::test::setInletProfile(jpp, 2, 0, 0.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 1.0, 0.5, 0.5);
+	cadet::test::setFlowRates(jpp, 1, 1.0, 0.5, 0.5);
+	cadet::test::setFlowRates(jpp, 2, 1.0, 0.5, 0.5);
+
+	jpp.pushScope("return");
+	jpp.set("WRITE_STATISTICS", true);
+	jpp.popScope();
+
+	const char* const fileName = "testStatistics.h5";
+
+	cadet::Driver drv;
+	drv.configure(jpp);
+	drv.run();
+
+	// Solution is still recorded at the user specified solution times
+	CHECK(drv.solution()->numDataPoints() == 120);
+
+	{
+		cadet::io::HDF5Writer writer;
+		writer.openFile(fileName, "co");
+		drv.write(writer);
+		writer.closeFile();
+	}
+
+	cadet::io::HDF5Reader reader;
+	reader.openFile(fileName, "r");
+	reader.pushGroup("output");
+	REQUIRE(reader.exists("statistics"));
+	reader.pushGroup("statistics");
+
+	const std::vector<double> time = reader.vector<double>("TIME");
+	const std::size_t nEntries = time.size();
+	REQUIRE(nEntries > 0);
+
+	for (const char* name : {"WALL_TIME", "LAST_STEP_SIZE", "NEXT_STEP_SIZE", "NUM_STEPS", "NUM_RES_EVALS", "NUM_NEWTON_ITERS",
+		"NUM_CONV_FAILS", "NUM_ERROR_TEST_FAILS", "NUM_COUPLING_GMRES_ITERS"})
+	{
+		CAPTURE(name);
+		CHECK(reader.arraySize(name) == nEntries);
+	}
+
+	// No sensitivities are computed
+	CHECK_FALSE(reader.exists("NUM_SENS_RES_EVALS"));
+
+	const std::vector<int> unitOps = reader.vector<int>("UNIT_OPERATIONS");
+	CHECK(unitOps == std::vector<int>({0, 1, 2}));
+	for (const char* name : {"NUM_FACTORIZATIONS", "NUM_GMRES_ITERS"})
+	{
+		CAPTURE(name);
+		CHECK(reader.tensorDimensions(name) == std::vector<std::size_t>({nEntries, unitOps.size()}));
+	}
+
+	// Entries are taken in each internal time step and reach the end of the simulation
+	const std::vector<int> numSteps = reader.vector<int>("NUM_STEPS");
+	const std::vector<int> numResEvals = reader.vector<int>("NUM_RES_EVALS");
+	int totalSteps = 0;
+	int totalResEvals = 0;
+	for (std::size_t i = 0; i < nEntries; ++i)
+	{
+		CAPTURE(i);
+		CHECK(numSteps[i] == 1);
+		CHECK(numResEvals[i] >= 1);
+		if (i > 0)
+			CHECK(time[i] > time[i-1]);
+
+		totalSteps += numSteps[i];
+		totalResEvals += numResEvals[i];
+	}
+	CHECK(time.back() == 119.0);
+	CHECK(static_cast<std::size_t>(totalSteps) == nEntries);
+	CHECK(totalResEvals >= totalSteps);
+
+	// Only the CSTR has a Jacobian to factorize
+	const std::vector<int> numFactorizations = reader.vector<int>("NUM_FACTORIZATIONS");
+	int totalFactorizations = 0;
+	for (std::size_t i = 0; i < nEntries; ++i)
+	{
+		totalFactorizations += numFactorizations[i * unitOps.size()];
+		CHECK(numFactorizations[i * unitOps.size() + 1] == 0);
+		CHECK(numFactorizations[i * unitOps.size() + 2] == 0);
+	}
+	CHECK(totalFactorizations >= 3);
+
+	reader.closeFile();
+	std::remove(fileName);
+}
+
+TEST_CASE("Driver applies lossy storage options only to solution datasets", "[HDF5][Simulation][StorageOptions]")
+{
+	cadet::JsonParameterProvider jpp = createCSTRBenchmark(1, 10.0, 1.0);
+	cadet::test::setSectionTimes(jpp, {0.0, 10.0});
+	cadet::test::setInitialConditions(jpp, {0.0}, {}, 10.0);
+	cadet::test::setInletProfile(jpp, 0, 0, 1.0, 0.0, 0.0, 0.0);
+	cadet::test::setFlowRates(jpp, 0, 1.0, 0.5, 0.5);
+
+	jpp.pushScope("return");
+	jpp.set("WRITE_SOLUTION_LAST", true);
+	jpp.set("WRITE_STATISTICS", true);
+	jpp.set("PRECISION", std::string("SINGLE"));
+	jpp.set("QUANTIZATION_DIGITS", 3);
+	jpp.popScope();
+
+	cadet::Driver drv;
+	drv.configure(jpp);
+	drv.run();
+
+	{
+		cadet::io::HDF5Writer writer;
+		writer.openFile(writerTestFile, "co");
+		drv.write(writer);
+		writer.closeFile();
+	}
+
+	const DatasetProperties sol = datasetProperties("/output/solution/unit_000/SOLUTION_VOLUME");
+	CHECK(sol.typeSize == sizeof(float));
+	CHECK(std::find(sol.filters.begin(), sol.filters.end(), H5Z_FILTER_SCALEOFFSET) != sol.filters.end());
+
+	for (const char* path : {"/output/solution/SOLUTION_TIMES", "/output/LAST_STATE_Y", "/output/LAST_STATE_YDOT", "/output/statistics/TIME", "/output/statistics/WALL_TIME"})
+	{
+		CAPTURE(path);
+		const DatasetProperties dp = datasetProperties(path);
+		CHECK(dp.typeSize == sizeof(double));
+		CHECK(std::find(dp.filters.begin(), dp.filters.end(), H5Z_FILTER_SCALEOFFSET) == dp.filters.end());
+	}
+
+	// Time points are stored exactly
+	cadet::io::HDF5Reader reader;
+	reader.openFile(writerTestFile, "r");
+	reader.pushGroup("output");
+	reader.pushGroup("solution");
+	const std::vector<double> time = reader.vector<double>("SOLUTION_TIMES");
+	reader.closeFile();
+
+	REQUIRE(time.size() == 11);
+	for (std::size_t i = 0; i < time.size(); ++i)
+		CHECK(time[i] == static_cast<double>(i));
+
+	std::remove(writerTestFile);
+}
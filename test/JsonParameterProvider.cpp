@@ -0,0 +1,169 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include <catch.hpp>
+#include <json.hpp>
+
+#define CADET_JSONPARAMETERPROVIDER_NOFORWARD
+#include "common/JsonParameterProvider.hpp"
+#include "common/CompactJsonParameterProvider.hpp"
+#include "io/IOException.hpp"
+
+#include "JsonTestModels.hpp"
+
+#include <sstream>
+#include <iomanip>
+#include <random>
+#include <limits>
+#include <cstdlib>
+#include <cmath>
+
+namespace
+{
+	/**
+	 * @brief Checks that both providers return the same values for all fields of the current scope
+	 */
+	void checkSameContent(const nlohmann::json& node, cadet::JsonParameterProvider& ref, cadet::CompactJsonParameterProvider& cpp)
+	{
+		for (nlohmann::json::const_iterator it = node.begin(); it != node.end(); ++it)
+		{
+			const std::string& key = it.key();
+			CAPTURE(key);
+
+			REQUIRE(cpp.exists(key));
+			CHECK(cpp.isArray(key) == ref.isArray(key));
+			CHECK(cpp.numElements(key) == ref.numElements(key));
+
+			const nlohmann::json& v = it.value();
+			if (v.is_object())
+			{
+				ref.pushScope(key);
+				cpp.pushScope(key);
+				checkSameContent(v, ref, cpp);
+				cpp.popScope();
+				ref.popScope();
+			}
+			else if (v.is_string())
+				CHECK(cpp.getString(key) == ref.getString(key));
+			else if (v.is_boolean())
+				CHECK(cpp.getBool(key) == ref.getBool(key));
+			else if (v.is_number_integer())
+				CHECK(cpp.getIntArray(key) == ref.getIntArray(key));
+			else if (v.is_array() && !v.empty() && v[0].is_string())
+				CHECK(cpp.getStringArray(key) == ref.getStringArray(key));
+			else if (v.is_array() && !v.empty() && (v[0].is_boolean() || v[0].is_number_integer()))
+				CHECK(cpp.getIntArray(key) == ref.getIntArray(key));
+			else if (v.is_number() || v.is_array())
+				CHECK(cpp.getDoubleArray(key) == ref.getDoubleArray(key));
+		}
+	}
+}
+
+TEST_CASE("CompactJsonParameterProvider reads same values as JsonParameterProvider", "[JsonParameterProvider]")
+{
+	for (const char* uoType : {"GENERAL_RATE_MODEL", "LUMPED_RATE_MODEL_WITH_PORES"})
+	{
+		cadet::JsonParameterProvider ref = createLWE(uoType);
+
+		std::ostringstream oss;
+		oss << ref;
+		cadet::CompactJsonParameterProvider cpp(oss.str());
+
+		checkSameContent(*ref.data(), ref, cpp);
+	}
+}
+
+TEST_CASE("CompactJsonParameterProvider converts numbers exactly", "[JsonParameterProvider]")
+{
+	std::mt19937 gen(7);
+	std::uniform_real_distribution<double> mantissa(-1.0, 1.0);
+	std::uniform_int_distribution<int> exponent(-30, 30);
+
+	std::vector<std::string> numbers{"0", "-0", "0.1", "-2.5e-3", "1E5", "123456789012345678", "9007199254740993",
+		"1.7976931348623157e308", "4.9e-324", "0.000000000000000000000000001", "12345678901234567890123"};
+	for (int i = 0; i < 2000; ++i)
+	{
+		std::ostringstream oss;
+		oss << std::setprecision(std::numeric_limits<double>::digits10 + ((i % 2 == 0) ? 2 : -6)) << mantissa(gen) * std::pow(10.0, exponent(gen));
+		numbers.push_back(oss.str());
+	}
+
+	std::string doc = "{\"V\": [";
+	for (std::size_t i = 0; i < numbers.size(); ++i)
+		doc += ((i > 0) ? ", " : "") + numbers[i];
+	doc += "]}";
+
+	cadet::CompactJsonParameterProvider cpp(doc);
+	const std::vector<double> v = cpp.getDoubleArray("V");
+	REQUIRE(v.size() == numbers.size());
+	for (std::size_t i = 0; i < numbers.size(); ++i)
+	{
+		CAPTURE(numbers[i]);
+		CHECK(v[i] == std::strtod(numbers[i].c_str(), nullptr));
+	}
+}
+
+TEST_CASE("CompactJsonParameterProvider handles scalars, arrays, and strings", "[JsonParameterProvider]")
+{
+	cadet::CompactJsonParameterProvider cpp(
+		"{\"A\": [3], \"B\": [true, false, 1], \"C\": [1, 2.5], \"D\": \"a\\\"b\\\\c\\u00e9\\ud83d\\ude00\","
+		" \"E\": [\"x\", \"y\"], \"F\": 18446744073709551615, \"G\": {\"H\": 1, \"H\": 2}, \"I\": [], \"J\": [1, \"z\"]}");
+
+	CHECK(cpp.getDouble("A") == 3.0);
+	CHECK(cpp.getInt("A") == 3);
+	CHECK(cpp.isArray("A"));
+	CHECK(cpp.getBoolArray("B") == std::vector<bool>{true, false, true});
+	CHECK(cpp.getIntArray("B") == std::vector<int>{1, 0, 1});
+	CHECK(cpp.getDoubleArray("C") == std::vector<double>{1.0, 2.5});
+	CHECK(cpp.getString("D") == "a\"b\\c\xC3\xA9\xF0\x9F\x98\x80");
+	CHECK(cpp.getStringArray("E") == std::vector<std::string>{"x", "y"});
+	CHECK(cpp.getUint64("F") == std::numeric_limits<uint64_t>::max());
+	CHECK(cpp.numElements("I") == 0);
+	CHECK(cpp.getDoubleArray("I").empty());
+	CHECK(cpp.numElements("J") == 2);
+	CHECK_FALSE(cpp.exists("K"));
+
+	cpp.pushScope("G");
+	CHECK(cpp.getInt("H") == 2);
+	CHECK(cpp.numElements("H") == 1);
+	cpp.popScope();
+
+	CHECK_THROWS_AS(cpp.getDouble("K"), cadet::io::IOException);
+	CHECK_THROWS_AS(cpp.getString("A"), cadet::io::IOException);
+	CHECK_THROWS_AS(cpp.getDouble("C"), cadet::io::IOException);
+	CHECK_THROWS_AS(cpp.pushScope("A"), cadet::io::IOException);
+
+	CHECK_THROWS_AS(cadet::CompactJsonParameterProvider("{\"A\": [1, 2}"), cadet::io::IOException);
+	CHECK_THROWS_AS(cadet::CompactJsonParameterProvider("{\"A\": 1.}"), cadet::io::IOException);
+	CHECK_THROWS_AS(cadet::CompactJsonParameterProvider("{\"A\": tru}"), cadet::io::IOException);
+	CHECK_THROWS_AS(cadet::CompactJsonParameterProvider("{\"A\": 1} x"), cadet::io::IOException);
+}
+
+TEST_CASE("CompactJsonParameterProvider handles arrays with signed and unsigned integers", "[JsonParameterProvider]")
+{
+	const double maxUint64 = static_cast<double>(std::numeric_limits<uint64_t>::max());
+
+	cadet::CompactJsonParameterProvider cpp(
+		"{\"A\": [-1, 18446744073709551615], \"B\": [18446744073709551615, -1], \"C\": [-1, 18446744073709551615, 2.5],"
+		" \"D\": [1, 18446744073709551615], \"E\": [-1, 2]}");
+
+	// Mixed signedness is stored as floating point
+	CHECK(cpp.getDoubleArray("A") == std::vector<double>{-1.0, maxUint64});
+	CHECK(cpp.getDoubleArray("B") == std::vector<double>{maxUint64, -1.0});
+	CHECK(cpp.getDoubleArray("C") == std::vector<double>{-1.0, maxUint64, 2.5});
+
+	// Otherwise, integers are stored exactly
+	CHECK(cpp.getUint64Array("D") == std::vector<uint64_t>{1, std::numeric_limits<uint64_t>::max()});
+	CHECK(cpp.getDoubleArray("D") == std::vector<double>{1.0, maxUint64});
+	CHECK(cpp.getIntArray("E") == std::vector<int>{-1, 2});
+	CHECK(cpp.getDoubleArray("E") == std::vector<double>{-1.0, 2.0});
+}
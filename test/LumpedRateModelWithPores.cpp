@@ -136,6 +136,23 @@ TEST_CASE("LRMP inlet DOF Jacobian", "[LRMP],[UnitOp],[Jacobian],[Inlet]")
 	cadet::test::column::testInletDofJacobian("LUMPED_RATE_MODEL_WITH_PORES");
 }
 
+TEST_CASE("LRMP linear solver statistics", "[LRMP],[UnitOp],[LinearSolver]")
+{
+	cadet::test::column::testLinearSolverStatistics("LUMPED_RATE_MODEL_WITH_PORES");
+}
+
+#ifdef CADET_ALLOCATION_TRACKING
+TEST_CASE("LRMP residual and linear solve are allocation free", "[LRMP],[UnitOp],[Residual],[Allocation]")
+{
+	cadet::test::column::testHotPathAllocationFree("LUMPED_RATE_MODEL_WITH_PORES");
+}
+
+TEST_CASE("LRMP time integration with sensitivities is allocation free", "[LRMP],[Simulation],[Sensitivity],[Allocation]")
+{
+	cadet::test::column::testSimulationAllocationFree("LUMPED_RATE_MODEL_WITH_PORES");
+}
+#endif
+
 TEST_CASE("LRMP LWE one vs two identical particle types match", "[LRMP],[Simulation],[ParticleType]")
 {
 	cadet::test::particle::testOneVsTwoIdenticalParticleTypes("LUMPED_RATE_MODEL_WITH_PORES", 2.2e-8, 6e-5);
@@ -12,10 +12,21 @@
 
 #include <catch.hpp>
 
+#include "cadet/cadet.hpp"
+#include "Approx.hpp"
 #include "ColumnTests.hpp"
 #include "ReactionModelTests.hpp"
+#include "UnitOperationTests.hpp"
+#include "JsonTestModels.hpp"
+#include "SimHelper.hpp"
 #include "Weno.hpp"
 #include "Utils.hpp"
+#include "ParallelSupport.hpp"
+#include "SimulationTypes.hpp"
+#include "model/UnitOperation.hpp"
+
+#include <cmath>
+#include <vector>
 
 TEST_CASE("LRM LWE forward vs backward flow", "[LRM],[Simulation]")
 {
@@ -127,6 +138,23 @@ TEST_CASE("LRM inlet DOF Jacobian", "[LRM],[UnitOp],[Jacobian],[Inlet]")
 	cadet::test::column::testInletDofJacobian("LUMPED_RATE_MODEL_WITHOUT_PORES");
 }
 
+TEST_CASE("LRM linear solver statistics", "[LRM],[UnitOp],[LinearSolver]")
+{
+	cadet::test::column::testLinearSolverStatistics("LUMPED_RATE_MODEL_WITHOUT_PORES");
+}
+
+#ifdef CADET_ALLOCATION_TRACKING
+TEST_CASE("LRM residual and linear solve are allocation free", "[LRM],[UnitOp],[Residual],[Allocation]")
+{
+	cadet::test::column::testHotPathAllocationFree("LUMPED_RATE_MODEL_WITHOUT_PORES");
+}
+
+TEST_CASE("LRM time integration with sensitivities is allocation free", "[LRM],[Simulation],[Sensitivity],[Allocation]")
+{
+	cadet::test::column::testSimulationAllocationFree("LUMPED_RATE_MODEL_WITHOUT_PORES");
+}
+#endif
+
 TEST_CASE("LRM dynamic reactions Jacobian vs AD bulk", "[LRM],[Jacobian],[AD],[ReactionModel]")
 {
 	cadet::test::reaction::testUnitJacobianDynamicReactionsAD("LUMPED_RATE_MODEL_WITHOUT_PORES", true, false, false);
@@ -146,3 +174,106 @@ TEST_CASE("LRM dynamic reactions time derivative Jacobian vs FD modified bulk",
 {
 	cadet::test::reaction::testTimeDerivativeJacobianDynamicReactionsFD("LUMPED_RATE_MODEL_WITHOUT_PORES", true, false, true, 1e-6, 1e-14, 8e-4);
 }
+
+namespace
+{
+	void testBlockSolverVsBandSolver(cadet::JsonParameterProvider& jpp, double const* const y)
+	{
+		cadet::IModelBuilder* const mb = cadet::createModelBuilder();
+		REQUIRE(nullptr != mb);
+
+		for (int i = 1; i <= cadet::Weno::maxOrder(); ++i)
+		{
+			cadet::test::column::setWenoOrder(jpp, i);
+			jpp.pushScope("discretization");
+			jpp.set("USE_BLOCK_SOLVER", false);
+			jpp.popScope();
+
+			cadet::IUnitOperation* const unitBand = cadet::test::unitoperation::createAndConfigureUnit(jpp, *mb);
+
+			jpp.pushScope("discretization");
+			jpp.set("USE_BLOCK_SOLVER", true);
+			jpp.popScope();
+
+			cadet::IUnitOperation* const unitBlock = cadet::test::unitoperation::createAndConfigureUnit(jpp, *mb);
+
+			const cadet::AdJacobianParams noParams{nullptr, nullptr, 0u};
+			unitBand->notifyDiscontinuousSectionTransition(0.0, 0u, noParams);
+			unitBlock->notifyDiscontinuousSectionTransition(0.0, 0u, noParams);
+
+			const unsigned int nDof = unitBand->numDofs();
+			std::vector<double> res(nDof, 0.0);
+			std::vector<double> rhsBand(nDof, 0.0);
+			std::vector<double> weight(nDof, 1.0);
+
+			// Fill right hand side with some values
+			cadet::test::util::populate(rhsBand.data(), [](unsigned int idx) { return std::sin(idx * 0.7) + 0.5; }, nDof);
+			std::vector<double> rhsBlock = rhsBand;
+
+			// Compute state Jacobian
+			cadet::util::ThreadLocalStorage tls;
+			tls.resize(unitBand->threadLocalMemorySize());
+
+			const cadet::SimulationTime simTime{0.0, 0u};
+			const cadet::ConstSimulationState simState{y, nullptr};
+			unitBand->residualWithJacobian(simTime, simState, res.data(), noParams, tls);
+			unitBlock->residualWithJacobian(simTime, simState, res.data(), noParams, tls);
+
+			// Solve linear systems and compare solutions
+			REQUIRE(0 == unitBand->linearSolve(0.0, 1.5, 1e-8, rhsBand.data(), weight.data(), simState));
+			REQUIRE(0 == unitBlock->linearSolve(0.0, 1.5, 1e-8, rhsBlock.data(), weight.data(), simState));
+
+			for (unsigned int j = 0; j < nDof; ++j)
+			{
+				CAPTURE(i);
+				CAPTURE(j);
+				CHECK(rhsBlock[j] == cadet::test::makeApprox(rhsBand[j], 1e-10, 1e-12));
+			}
+
+			mb->destroyUnitOperation(unitBlock);
+			mb->destroyUnitOperation(unitBand);
+		}
+
+		destroyModelBuilder(mb);
+	}
+}
+
+TEST_CASE("LRM block solver vs band solver with linear binding", "[LRM],[UnitOp],[Jacobian],[LinearSolver]")
+{
+	for (int bindMode = 0; bindMode < 2; ++bindMode)
+	{
+		const bool isKinetic = bindMode;
+		SECTION(isKinetic ? "Kinetic binding" : "Quasi-stationary binding")
+		{
+			cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding("LUMPED_RATE_MODEL_WITHOUT_PORES");
+			cadet::test::setBindingMode(jpp, isKinetic);
+
+			const unsigned int nDof = 2 + 15 * (2 + 2);
+			std::vector<double> y(nDof, 0.0);
+			cadet::test::util::populate(y.data(), [](unsigned int idx) { return std::abs(std::sin(idx * 0.13)) + 1e-4; }, nDof);
+
+			testBlockSolverVsBandSolver(jpp, y.data());
+		}
+	}
+}
+
+TEST_CASE("LRM block solver vs band solver with SMA binding", "[LRM],[UnitOp],[Jacobian],[LinearSolver]")
+{
+	for (int bindMode = 0; bindMode < 2; ++bindMode)
+	{
+		const bool isKinetic = bindMode;
+		SECTION(isKinetic ? "Kinetic binding" : "Quasi-stationary binding")
+		{
+			cadet::JsonParameterProvider jpp = createColumnWithSMA("LUMPED_RATE_MODEL_WITHOUT_PORES");
+			cadet::test::setBindingMode(jpp, isKinetic);
+
+			std::vector<double> y(4 + 16 * (4 + 4), 0.0);
+			const double bindingCell[] = {1.2, 2.0, 1.0, 1.5, 840.0, 63.0, 3.0, 3.0, 
+				1.0, 1.8, 1.5, 1.6, 840.0, 63.0, 6.0, 3.0};
+			cadet::test::util::populate(y.data(), [](unsigned int idx) { return std::abs(std::sin(idx * 0.13)) + 1e-4; }, 4);
+			cadet::test::util::repeat(y.data() + 4, bindingCell, 16, 8);
+
+			testBlockSolverVsBandSolver(jpp, y.data());
+		}
+	}
+}
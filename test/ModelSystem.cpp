@@ -203,6 +203,7 @@ namespace
 		}
 
 		virtual unsigned int threadLocalMemorySize() const CADET_NOEXCEPT { return 0; }
+		virtual cadet::LinearSolverStatistics linearSolverStatistics() const CADET_NOEXCEPT { return cadet::LinearSolverStatistics{0, 0}; }
 
 		inline const std::vector<cadet::active>& inFlow() const CADET_NOEXCEPT { return _inFlow; }
 		inline const std::vector<cadet::active>& outFlow() const CADET_NOEXCEPT { return _outFlow; }
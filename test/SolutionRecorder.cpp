@@ -0,0 +1,354 @@
+// =============================================================================
+//  CADET - The Chromatography Analysis and Design Toolkit
+//  
+//  Copyright © 2008-2020: The CADET Authors
+//            Please see the AUTHORS and CONTRIBUTORS file.
+//  
+//  All rights reserved. This program and the accompanying materials
+//  are made available under the terms of the GNU Public License v3.0 (or, at
+//  your option, any later version) which accompanies this distribution, and
+//  is available at http://www.gnu.org/licenses/gpl.html
+// =============================================================================
+
+#include <catch.hpp>
+
+#include "cadet/cadet.hpp"
+#include "common/JsonParameterProvider.hpp"
+#include "common/SolutionRecorderImpl.hpp"
+#include "common/SharedMemoryRecorder.hpp"
+
+#include "model/UnitOperation.hpp"
+#include "JsonTestModels.hpp"
+#include "UnitOperationTests.hpp"
+
+#include <vector>
+#include <numeric>
+
+namespace
+{
+	// Discretization of createColumnWithTwoCompLinearBinding()
+	const unsigned int nCol = 15;
+	const unsigned int nPar = 5;
+	const unsigned int nComp = 2;
+	const unsigned int nBound = 2;
+
+	inline void prepareRecorder(cadet::InternalStorageSystemRecorder& rec, const cadet::IUnitOperation& unit, unsigned int numTimesteps)
+	{
+		rec.prepare(unit.numDofs(), 0, numTimesteps);
+		unit.reportSolutionStructure(rec);
+		rec.notifyIntegrationStart(unit.numDofs(), 0, numTimesteps);
+		unit.reportSolutionStructure(rec);
+	}
+
+	inline void recordTimesteps(cadet::InternalStorageSystemRecorder& rec, const cadet::IUnitOperation& unit, const std::vector<double>& time)
+	{
+		std::vector<double> y(unit.numDofs(), 0.0);
+		for (unsigned int i = 0; i < time.size(); ++i)
+		{
+			std::iota(y.begin(), y.end(), 1000.0 * i);
+
+			rec.beginTimestep(time[i]);
+			rec.beginSolution();
+			unit.reportSolution(rec, y.data());
+			rec.endSolution();
+			rec.endTimestep();
+		}
+	}
+
+	inline cadet::InternalStorageUnitOpRecorder::StorageConfig allDataConfig()
+	{
+		cadet::InternalStorageUnitOpRecorder::StorageConfig cfg;
+		cfg.storeOutlet = true;
+		cfg.storeInlet = true;
+		cfg.storeBulk = true;
+		cfg.storeParticle = true;
+		cfg.storeSolid = true;
+		cfg.storeFlux = false;
+		cfg.storeVolume = false;
+		cfg.storeSolidParticleAverage = false;
+		cfg.storeSolidColumnAverage = false;
+		return cfg;
+	}
+}
+
+TEST_CASE("InternalStorageUnitOpRecorder records region of interest", "[SolutionRecorder]")
+{
+	cadet::IModelBuilder* const mb = cadet::createModelBuilder();
+	REQUIRE(nullptr != mb);
+
+	cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding("GENERAL_RATE_MODEL");
+	cadet::IUnitOperation* const unit = cadet::test::unitoperation::createAndConfigureUnit("GENERAL_RATE_MODEL", *mb, jpp);
+
+	cadet::InternalStorageSystemRecorder rec;
+
+	cadet::InternalStorageUnitOpRecorder* const full = new cadet::InternalStorageUnitOpRecorder(0);
+	full->solutionConfig(allDataConfig());
+	full->storeCoordinates(true);
+	rec.addRecorder(full);
+
+	cadet::InternalStorageUnitOpRecorder::StorageConfig cfg = allDataConfig();
+	cfg.storeSolidParticleAverage = true;
+	cfg.storeSolidColumnAverage = true;
+
+	cadet::InternalStorageUnitOpRecorder* const roi = new cadet::InternalStorageUnitOpRecorder(0);
+	roi->solutionConfig(cfg);
+	roi->recordAxialCells({7, 3, 11, 3});
+	roi->recordParticleShells({4, 0});
+	roi->recordComponents({1});
+	roi->decimation(2, 0.0);
+	roi->storeCoordinates(true);
+	rec.addRecorder(roi);
+
+	prepareRecorder(rec, *unit, 0);
+	recordTimesteps(rec, *unit, {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+
+	const std::vector<unsigned int> cells{3, 7, 11};
+	const std::vector<unsigned int> shells{0, 4};
+
+	REQUIRE(full->numDataPoints() == 7);
+	REQUIRE(roi->numDataPoints() == 4);
+	CHECK(roi->numComponents() == nComp);
+	CHECK(roi->numRecordedComponents() == 1);
+
+	REQUIRE(roi->axialCoordinates().size() == cells.size());
+	for (unsigned int c = 0; c < cells.size(); ++c)
+		CHECK(roi->axialCoordinates()[c] == full->axialCoordinates()[cells[c]]);
+
+	REQUIRE(roi->particleCoordinates().size() == shells.size());
+	for (unsigned int s = 0; s < shells.size(); ++s)
+		CHECK(roi->particleCoordinates()[s] == full->particleCoordinates()[shells[s]]);
+
+	// Equidistant spherical shells, shell 0 is the outermost one
+	std::vector<double> shellVolume(shells.size());
+	for (unsigned int s = 0; s < shells.size(); ++s)
+	{
+		const double rOut = static_cast<double>(nPar - shells[s]);
+		shellVolume[s] = rOut * rOut * rOut - (rOut - 1.0) * (rOut - 1.0) * (rOut - 1.0);
+	}
+	const double totalShellVolume = std::accumulate(shellVolume.begin(), shellVolume.end(), 0.0);
+
+	for (unsigned int k = 0; k < roi->numDataPoints(); ++k)
+	{
+		const unsigned int t = 2 * k;
+		CAPTURE(k);
+
+		CHECK(roi->time()[k] == static_cast<double>(t));
+		CHECK(roi->outlet()[k] == full->outlet()[t * nComp + 1]);
+		CHECK(roi->inlet()[k] == full->inlet()[t * nComp + 1]);
+
+		double colAvg[nBound] = {0.0, 0.0};
+		for (unsigned int c = 0; c < cells.size(); ++c)
+		{
+			CHECK(roi->bulk()[k * cells.size() + c] == full->bulk()[(t * nCol + cells[c]) * nComp + 1]);
+
+			double parAvg[nBound] = {0.0, 0.0};
+			for (unsigned int s = 0; s < shells.size(); ++s)
+			{
+				const unsigned int fullBlock = (t * nCol + cells[c]) * nPar + shells[s];
+				const unsigned int roiBlock = (k * cells.size() + c) * shells.size() + s;
+
+				CHECK(roi->particle()[roiBlock] == full->particle()[fullBlock * nComp + 1]);
+				for (unsigned int b = 0; b < nBound; ++b)
+				{
+					CHECK(roi->solid()[roiBlock * nBound + b] == full->solid()[fullBlock * nBound + b]);
+					parAvg[b] += full->solid()[fullBlock * nBound + b] * shellVolume[s] / totalShellVolume;
+					colAvg[b] += full->solid()[fullBlock * nBound + b] * shellVolume[s] / (totalShellVolume * cells.size());
+				}
+			}
+
+			for (unsigned int b = 0; b < nBound; ++b)
+				CHECK(roi->solidParticleAverage()[(k * cells.size() + c) * nBound + b] == Approx(parAvg[b]));
+		}
+
+		for (unsigned int b = 0; b < nBound; ++b)
+			CHECK(roi->solidColumnAverage()[k * nBound + b] == Approx(colAvg[b]));
+	}
+
+	mb->destroyUnitOperation(unit);
+	destroyModelBuilder(mb);
+}
+
+TEST_CASE("InternalStorageUnitOpRecorder decimates by minimum time difference", "[SolutionRecorder]")
+{
+	cadet::IModelBuilder* const mb = cadet::createModelBuilder();
+	REQUIRE(nullptr != mb);
+
+	cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding("GENERAL_RATE_MODEL");
+	cadet::IUnitOperation* const unit = cadet::test::unitoperation::createAndConfigureUnit("GENERAL_RATE_MODEL", *mb, jpp);
+
+	cadet::InternalStorageSystemRecorder rec;
+	cadet::InternalStorageUnitOpRecorder* const dec = new cadet::InternalStorageUnitOpRecorder(0);
+	dec->solutionConfig(allDataConfig());
+	dec->decimation(1, 1.0);
+	rec.addRecorder(dec);
+
+	const std::vector<double> time{0.0, 0.25, 0.5, 1.0, 1.5, 2.5, 2.75, 4.0, 4.5};
+	prepareRecorder(rec, *unit, time.size());
+	recordTimesteps(rec, *unit, time);
+
+	const std::vector<double> expected{0.0, 1.0, 2.5, 4.0, 4.5};
+	REQUIRE(dec->numDataPoints() == expected.size());
+	for (unsigned int k = 0; k < expected.size(); ++k)
+		CHECK(dec->time()[k] == expected[k]);
+
+	mb->destroyUnitOperation(unit);
+	destroyModelBuilder(mb);
+}
+
+TEST_CASE("InternalStorageUnitOpRecorder keeps last time point when decimating", "[SolutionRecorder]")
+{
+	cadet::IModelBuilder* const mb = cadet::createModelBuilder();
+	REQUIRE(nullptr != mb);
+
+	cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding("GENERAL_RATE_MODEL");
+	cadet::IUnitOperation* const unit = cadet::test::unitoperation::createAndConfigureUnit("GENERAL_RATE_MODEL", *mb, jpp);
+
+	cadet::InternalStorageSystemRecorder rec;
+
+	cadet::InternalStorageUnitOpRecorder* const full = new cadet::InternalStorageUnitOpRecorder(0);
+	full->solutionConfig(allDataConfig());
+	rec.addRecorder(full);
+
+	cadet::InternalStorageUnitOpRecorder* const dec = new cadet::InternalStorageUnitOpRecorder(0);
+	dec->solutionConfig(allDataConfig());
+	dec->decimation(3, 0.0);
+	rec.addRecorder(dec);
+
+	// 8 time points, so that the last one (index 7) is not a multiple of RECORD_EVERY
+	const std::vector<double> time{0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0};
+	prepareRecorder(rec, *unit, time.size());
+	recordTimesteps(rec, *unit, time);
+
+	const std::vector<unsigned int> expected{0, 3, 6, 7};
+	REQUIRE(full->numDataPoints() == time.size());
+	REQUIRE(dec->numDataPoints() == expected.size());
+	for (unsigned int k = 0; k < expected.size(); ++k)
+	{
+		const unsigned int t = expected[k];
+		CAPTURE(k);
+
+		CHECK(dec->time()[k] == time[t]);
+		CHECK(dec->outlet()[k * nComp] == full->outlet()[t * nComp]);
+		for (unsigned int i = 0; i < nCol * nComp; ++i)
+			CHECK(dec->bulk()[k * nCol * nComp + i] == full->bulk()[t * nCol * nComp + i]);
+	}
+
+	// Second integration reuses the recorder
+	rec.notifyIntegrationStart(unit->numDofs(), 0, 5);
+	unit->reportSolutionStructure(rec);
+	recordTimesteps(rec, *unit, {0.0, 1.0, 2.0, 3.0, 4.0});
+
+	REQUIRE(dec->numDataPoints() == 3);
+	CHECK(dec->time()[0] == 0.0);
+	CHECK(dec->time()[1] == 3.0);
+	CHECK(dec->time()[2] == 4.0);
+
+	mb->destroyUnitOperation(unit);
+	destroyModelBuilder(mb);
+}
+
+TEST_CASE("InternalStorageUnitOpRecorder rejects invalid region of interest", "[SolutionRecorder]")
+{
+	cadet::IModelBuilder* const mb = cadet::createModelBuilder();
+	REQUIRE(nullptr != mb);
+
+	cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding("GENERAL_RATE_MODEL");
+	cadet::IUnitOperation* const unit = cadet::test::unitoperation::createAndConfigureUnit("GENERAL_RATE_MODEL", *mb, jpp);
+
+	cadet::InternalStorageUnitOpRecorder rec(0);
+	rec.solutionConfig(allDataConfig());
+
+	rec.recordAxialCells({nCol});
+	CHECK_THROWS_AS(unit->reportSolutionStructure(rec), cadet::InvalidParameterException);
+
+	rec.recordAxialCells({});
+	rec.recordParticleShells({nPar});
+	CHECK_THROWS_AS(unit->reportSolutionStructure(rec), cadet::InvalidParameterException);
+
+	rec.recordParticleShells({});
+	rec.recordComponents({nComp});
+	CHECK_THROWS_AS(unit->reportSolutionStructure(rec), cadet::InvalidParameterException);
+
+	rec.recordComponents({0});
+	CHECK_NOTHROW(unit->reportSolutionStructure(rec));
+
+	mb->destroyUnitOperation(unit);
+	destroyModelBuilder(mb);
+}
+
+#ifdef CADET_SHARED_MEMORY_RECORDER_AVAILABLE
+
+TEST_CASE("SharedMemoryRecorder publishes outlet and bulk in ring buffer", "[SolutionRecorder]")
+{
+	cadet::IModelBuilder* const mb = cadet::createModelBuilder();
+	REQUIRE(nullptr != mb);
+
+	cadet::JsonParameterProvider jpp = createColumnWithTwoCompLinearBinding("GENERAL_RATE_MODEL");
+	cadet::IUnitOperation* const unit = cadet::test::unitoperation::createAndConfigureUnit("GENERAL_RATE_MODEL", *mb, jpp);
+
+	cadet::InternalStorageSystemRecorder rec;
+	cadet::InternalStorageUnitOpRecorder* const full = new cadet::InternalStorageUnitOpRecorder(0);
+	full->solutionConfig(allDataConfig());
+	rec.addRecorder(full);
+
+	const unsigned int capacity = 3;
+	cadet::SharedMemoryRecorder shmRec("/cadet-test-" + std::to_string(getpid()), capacity);
+	shmRec.storeBulk(true);
+	rec.addListener(&shmRec);
+
+	prepareRecorder(rec, *unit, 0);
+	recordTimesteps(rec, *unit, {0.0, 1.0, 2.0, 3.0, 4.0});
+	REQUIRE(shmRec.numDataPoints() == 5);
+
+	// Map segment like a consumer would
+	const int fd = shm_open(shmRec.name().c_str(), O_RDONLY, 0);
+	REQUIRE(fd >= 0);
+
+	struct stat st;
+	REQUIRE(fstat(fd, &st) == 0);
+	void* const mem = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	REQUIRE(mem != MAP_FAILED);
+	char const* const segment = static_cast<char const*>(mem);
+
+	const cadet::shm::Header* const header = reinterpret_cast<const cadet::shm::Header*>(segment);
+	CHECK(header->magic == cadet::shm::magic);
+	CHECK(header->version == cadet::shm::version);
+	CHECK(header->segmentSize == static_cast<std::uint64_t>(st.st_size));
+	CHECK(header->capacity == capacity);
+	CHECK(header->numWritten.load() == 5);
+	REQUIRE(header->numUnits == 1);
+
+	const cadet::shm::UnitLayout& layout = *reinterpret_cast<const cadet::shm::UnitLayout*>(segment + sizeof(cadet::shm::Header));
+	CHECK(layout.unitOpIdx == 0);
+	CHECK(layout.numComponents == nComp);
+	CHECK(layout.numOutletPorts == 1);
+	CHECK(layout.numAxialCells == nCol);
+	CHECK(layout.numBulkDofs == nCol * nComp);
+
+	// Ring buffer holds the last time steps
+	for (std::uint64_t k = header->numWritten.load() - capacity; k < header->numWritten.load(); ++k)
+	{
+		CAPTURE(k);
+
+		char const* const slot = segment + header->dataOffset + (k % header->capacity) * header->slotSize;
+		const cadet::shm::SlotHeader* const sh = reinterpret_cast<const cadet::shm::SlotHeader*>(slot);
+		CHECK(sh->sequence.load() == k + 1);
+		CHECK(sh->time == static_cast<double>(k));
+
+		double const* const outlet = reinterpret_cast<double const*>(slot + layout.outletOffset);
+		for (unsigned int i = 0; i < nComp; ++i)
+			CHECK(outlet[i] == full->outlet()[k * nComp + i]);
+
+		double const* const bulk = reinterpret_cast<double const*>(slot + layout.bulkOffset);
+		for (unsigned int i = 0; i < nCol * nComp; ++i)
+			CHECK(bulk[i] == full->bulk()[k * nCol * nComp + i]);
+	}
+
+	munmap(mem, st.st_size);
+	close(fd);
+
+	mb->destroyUnitOperation(unit);
+	destroyModelBuilder(mb);
+}
+
+#endif
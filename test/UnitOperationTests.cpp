@@ -28,6 +28,13 @@
 #include "SimulationTypes.hpp"
 #include "ParallelSupport.hpp"
 
+#ifdef CADET_ALLOCATION_TRACKING
+	#include "cadet/Notification.hpp"
+	#include "common/Driver.hpp"
+	#include "SimulatorImpl.hpp"
+	#include "AllocationTracker.hpp"
+#endif
+
 #include "Utils.hpp"
 
 #include <vector>
@@ -358,6 +365,73 @@ namespace unitoperation
 		delete[] adY;
 	}
 
+#ifdef CADET_ALLOCATION_TRACKING
+	namespace
+	{
+		/**
+		 * @brief Takes a snapshot of the allocation statistics of the simulator after some time steps
+		 */
+		class AllocationSnapshotNotifier : public cadet::INotificationCallback
+		{
+		public:
+			AllocationSnapshotNotifier(const cadet::Simulator& sim, unsigned int numWarmupSteps) : _sim(sim), _numWarmupSteps(numWarmupSteps), _numSteps(0) { }
+
+			virtual void timeIntegrationStart() { }
+			virtual void timeIntegrationEnd() { }
+			virtual void timeIntegrationError(char const* message, unsigned int section, double time, double progress) { }
+			virtual bool timeIntegrationSection(unsigned int section, double time, double const* state, double const* stateDot, double progress) { return true; }
+
+			virtual bool timeIntegrationStep(unsigned int section, double time, double const* state, double const* stateDot, double progress)
+			{
+				++_numSteps;
+				if (_numSteps == _numWarmupSteps)
+				{
+					_residual = _sim.allocationsResidual();
+					_residualSens = _sim.allocationsResidualSens();
+					_linearSolve = _sim.allocationsLinearSolve();
+				}
+				return true;
+			}
+
+			inline unsigned int numSteps() const CADET_NOEXCEPT { return _numSteps; }
+			inline const cadet::util::AllocationStatistics& residual() const CADET_NOEXCEPT { return _residual; }
+			inline const cadet::util::AllocationStatistics& residualSens() const CADET_NOEXCEPT { return _residualSens; }
+			inline const cadet::util::AllocationStatistics& linearSolve() const CADET_NOEXCEPT { return _linearSolve; }
+
+		protected:
+			const cadet::Simulator& _sim;
+			unsigned int _numWarmupSteps;
+			unsigned int _numSteps;
+			cadet::util::AllocationStatistics _residual;
+			cadet::util::AllocationStatistics _residualSens;
+			cadet::util::AllocationStatistics _linearSolve;
+		};
+	}
+
+	void testSimulationAllocationFree(cadet::JsonParameterProvider& jpp)
+	{
+		const unsigned int numWarmupSteps = 3;
+
+		cadet::Driver drv;
+		drv.configure(jpp);
+		REQUIRE(drv.simulator()->numSensParams() > 0);
+
+		cadet::Simulator const* const sim = static_cast<cadet::Simulator const*>(drv.simulator());
+		AllocationSnapshotNotifier notifier(*sim, numWarmupSteps);
+		drv.simulator()->setNotificationCallback(&notifier);
+		drv.run();
+
+		REQUIRE(notifier.numSteps() > numWarmupSteps);
+		REQUIRE(sim->allocationsResidual().calls > notifier.residual().calls);
+		REQUIRE(sim->allocationsResidualSens().calls > notifier.residualSens().calls);
+		REQUIRE(sim->allocationsLinearSolve().calls > notifier.linearSolve().calls);
+
+		CHECK(sim->allocationsResidual().allocations == notifier.residual().allocations);
+		CHECK(sim->allocationsResidualSens().allocations == notifier.residualSens().allocations);
+		CHECK(sim->allocationsLinearSolve().allocations == notifier.linearSolve().allocations);
+	}
+#endif
+
 } // namespace unitoperation
 } // namespace test
 } // namespace cadet
@@ -92,6 +92,17 @@ namespace unitoperation
 	 */
 	void testInletDofJacobian(cadet::IUnitOperation* const unit, bool adEnabled);
 
+#ifdef CADET_ALLOCATION_TRACKING
+	/**
+	 * @brief Checks that the time integrator callbacks do not allocate heap memory
+	 * @details Runs the simulation and takes a snapshot of the allocation statistics of the simulator
+	 *          after the first time steps. The residual, the sensitivity residual, and the linear solver
+	 *          must not allocate heap memory after that point.
+	 * @param [in] jpp Simulation configuration including forward sensitivities
+	 */
+	void testSimulationAllocationFree(cadet::JsonParameterProvider& jpp);
+#endif
+
 } // namespace unitoperation
 } // namespace test
 } // namespace cadet